@@ -327,6 +327,39 @@ int cmd_sid_print_heap_stats(const struct shell *shell, int32_t argc, const char
 void print_open_buffers(void);
 #endif
 
+#ifdef CONFIG_SIDEWALK_HEAP_POOL_STATS
+int cmd_sid_print_mem_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#if defined(CONFIG_SIDEWALK_TIMER_STATS) || defined(CONFIG_SIDEWALK_TIMER_LATENCY_STATS)
+int cmd_sid_print_timer_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+int cmd_sid_print_critical_region_stats(const struct shell *shell, int32_t argc,
+					const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+int cmd_sid_print_busy_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+int cmd_sid_print_spi_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+int cmd_sid_print_radio_cache_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+int cmd_sid_print_kv_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+int cmd_sid_print_dfu_img_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
 struct cli_config {
 	const struct shell *shell;
 	enum sid_link_type send_link_type;
@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <zephyr/shell/shell.h>
+#include <zephyr/sys/slist.h>
 #include <sid_bulk_data_transfer_api.h>
 
 #define CMD_SBDT_INIT_DESCRIPTION                                                                  \
@@ -103,6 +104,15 @@ struct sbdt_file_info {
 	uint16_t current_block_num;
 	uint32_t block_size;
 	uint32_t crc;
+	/* bytes of the file in the crc */
+	uint32_t crc_offset;
+	/* bytes of the file in the last persisted crc */
+	uint32_t checkpoint_offset;
+	/* buffers waiting for the next checkpoint, released after it */
+	sys_slist_t unreleased;
+	uint16_t fragments_since_checkpoint;
+	/* false when a part of the file is missing from the crc */
+	bool crc_valid;
 	uint32_t file_id;
 	uint32_t file_size;
 	uint32_t file_offset;
@@ -113,3 +123,23 @@ struct sbdt_file_info {
 };
 
 struct sbdt_file_info *get_file_info_by_id(uint32_t file_id);
+
+/**
+ * @brief Persist the running CRC of the ongoing file transfers.
+ *
+ * Called before a reboot, so the transfer resumes from the last received fragment.
+ */
+void sbdt_file_transfer_checkpoint(void);
+
+struct sbdt_buffer_release_ctx;
+
+/**
+ * @brief Queue the release of a fragment buffer until the CRC checkpoint covers it.
+ *
+ * Releasing a buffer acknowledges the fragment. The buffers are queued until a checkpoint is
+ * due, it is written, and all queued buffers of the file are given back to be released.
+ *
+ * @param ctx release of the buffer, owned by the queue.
+ * @param ready buffers to release now, in order.
+ */
+void sbdt_file_transfer_release_queue(struct sbdt_buffer_release_ctx *ctx, sys_slist_t *ready);
@@ -27,6 +27,7 @@ struct sbdt_finalize_resp_ctx {
 	struct k_timer delay;
 };
 struct sbdt_buffer_release_ctx {
+	sys_snode_t node;
 	int file_id;
 	struct sid_bulk_data_transfer_buffer transfer_buffer;
 	struct k_timer delay;
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DFU_BLOCK_MAP_H
+#define DFU_BLOCK_MAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DFU_BLOCK_MAP_CHUNK_SIZE 32
+
+/**
+ * @brief Fragments of a file received so far.
+ *
+ * One bit per fragment, kept in RAM and saved to the key-value storage every few fragments,
+ * so a transfer of the same file continues after a reboot.
+ */
+struct dfu_block_map {
+	uint32_t file_id;
+	uint32_t file_size;
+	uint32_t block_size;
+	uint32_t block_count;
+	uint32_t received;
+	/* chunks of the bitmap not saved yet, one bit per chunk */
+	uint32_t dirty_chunks;
+	uint16_t blocks_since_save;
+	uint8_t bits[CONFIG_SIDEWALK_FILE_TRANSFER_DFU_BITMAP_SIZE];
+};
+
+/**
+ * @brief Open the map of a file.
+ *
+ * The saved map is restored if it belongs to the same file, otherwise the saved map is deleted
+ * and the map starts empty.
+ *
+ * @param map map to open.
+ * @param file_id id of the file.
+ * @param file_size size of the file.
+ * @param block_size size of a fragment, all but the last fragment have this size.
+ * @return 1 if the saved map was restored, 0 if the map is empty,
+ *  -EINVAL on invalid arguments, -EFBIG if the file has too many fragments.
+ */
+int dfu_block_map_open(struct dfu_block_map *map, uint32_t file_id, uint32_t file_size,
+		       uint32_t block_size);
+
+/**
+ * @brief Check if the fragment at the offset was received.
+ *
+ * @param map map of the file.
+ * @param offset offset of the fragment in the file.
+ * @return true if the fragment was received.
+ */
+bool dfu_block_map_test(const struct dfu_block_map *map, uint32_t offset);
+
+/**
+ * @brief Check if any fragment overlapping the range was received.
+ *
+ * @param map map of the file.
+ * @param start first byte of the range.
+ * @param end byte after the range.
+ * @return true if at least one fragment in the range was received.
+ */
+bool dfu_block_map_any(const struct dfu_block_map *map, uint32_t start, uint32_t end);
+
+/**
+ * @brief Mark the fragment at the offset as received.
+ *
+ * The map is saved every CONFIG_SIDEWALK_FILE_TRANSFER_DFU_SAVE_FRAGMENTS fragments
+ * and when the last missing fragment is received.
+ *
+ * @param map map of the file.
+ * @param offset offset of the fragment in the file.
+ * @return 0 on success, -EINVAL if the offset is not at a fragment,
+ *  negative error code if the map could not be saved.
+ */
+int dfu_block_map_set(struct dfu_block_map *map, uint32_t offset);
+
+/**
+ * @brief Save the changed parts of the map.
+ *
+ * @param map map of the file.
+ * @return 0 on success, negative error code otherwise.
+ */
+int dfu_block_map_save(struct dfu_block_map *map);
+
+/**
+ * @brief Forget the file, delete the saved map.
+ *
+ * @param map map of the file.
+ */
+void dfu_block_map_clear(struct dfu_block_map *map);
+
+/**
+ * @brief Check if all fragments were received.
+ *
+ * @param map map of the file.
+ * @return true if the file is complete.
+ */
+static inline bool dfu_block_map_complete(const struct dfu_block_map *map)
+{
+	return map->block_count && map->received == map->block_count;
+}
+
+/**
+ * @brief Offset of the first fragment not received yet.
+ *
+ * @param map map of the file.
+ * @return offset of the fragment, or the file size if the file is complete.
+ */
+uint32_t dfu_block_map_first_missing(const struct dfu_block_map *map);
+
+#endif /* DFU_BLOCK_MAP_H */
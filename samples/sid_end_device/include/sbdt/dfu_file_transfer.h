@@ -32,4 +32,11 @@ void app_file_transfer_demo_deinit(struct sid_handle *handle);
  */
 void sidewalk_event_file_transfer(sidewalk_ctx_t *sid, void *ctx);
 
+/**
+ * @brief Save the fragments of the image received so far.
+ *
+ * A transfer of the same file resumes from the saved fragments after a reboot.
+ */
+void dfu_file_transfer_checkpoint(void);
+
 #endif /* FILE_TRANSFER_H */
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DFU_SLOT_H
+#define DFU_SLOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sbdt/dfu_block_map.h>
+
+/**
+ * @brief Open the MCUboot secondary slot.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int dfu_slot_open(void);
+
+/**
+ * @brief Get the write alignment of the slot.
+ *
+ * @return alignment in bytes, fragments must be a multiple of it.
+ */
+size_t dfu_slot_align(void);
+
+/**
+ * @brief Get the size of the slot.
+ *
+ * @return size of the slot in bytes.
+ */
+size_t dfu_slot_size(void);
+
+/**
+ * @brief Prepare the slot for a new image, erase the image trailer.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int dfu_slot_prepare(void);
+
+/**
+ * @brief Write a fragment of the image at its offset.
+ *
+ * Pages without any received fragment are erased first. A fragment not aligned to
+ * dfu_slot_align() is padded with the erased value, this is valid only for the last one.
+ *
+ * @param map fragments already written, the fragment must not be marked yet.
+ * @param offset offset of the fragment in the image.
+ * @param data fragment data.
+ * @param size size of the fragment.
+ * @return 0 on success, negative error code otherwise.
+ */
+int dfu_slot_write(const struct dfu_block_map *map, uint32_t offset, const uint8_t *data,
+		   size_t size);
+
+/**
+ * @brief Check the image header and mark the image for a test upgrade.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int dfu_slot_finalize(void);
+
+#endif /* DFU_SLOT_H */
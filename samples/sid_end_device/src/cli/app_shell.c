@@ -18,6 +18,24 @@
 #include <sid_900_cfg.h>
 #include <sid_ble_config_ifc.h>
 #include <sid_hal_memory_ifc.h>
+#include <sid_hal_memory_ext.h>
+#include <sid_timer_ext.h>
+#include <sid_critical_region_ext.h>
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+#include <semtech_busy_wait.h>
+#endif
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+#include <sid_serial_bus_ext.h>
+#endif
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+#include <semtech_cmd_cache.h>
+#endif
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+#include <sid_storage_kv_ext.h>
+#endif
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+#include <sidewalk_dfu/nordic_dfu_img.h>
+#endif
 
 #include <cli/app_shell.h>
 #include <cli/app_dut.h>
@@ -144,6 +162,39 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      CMD_SID_CLEAR_METRICS_DESCRIPTION_ARG_OPTIONAL),
 #ifdef CONFIG_SIDEWALK_TRACE_HEAP
 	SHELL_CMD_ARG(heap_stat, NULL, "print heap statistics", cmd_sid_print_heap_stats, 1, 0),
+#endif
+#ifdef CONFIG_SIDEWALK_HEAP_POOL_STATS
+	SHELL_CMD_ARG(mem_stat, NULL, "print heap pool statistics, -c to clear",
+		      cmd_sid_print_mem_stats, 1, 1),
+#endif
+#if defined(CONFIG_SIDEWALK_TIMER_STATS) || defined(CONFIG_SIDEWALK_TIMER_LATENCY_STATS)
+	SHELL_CMD_ARG(timer_stat, NULL, "print timer statistics, -c to clear",
+		      cmd_sid_print_timer_stats, 1, 1),
+#endif
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+	SHELL_CMD_ARG(crit_stat, NULL, "print critical region statistics, -c to clear",
+		      cmd_sid_print_critical_region_stats, 1, 1),
+#endif
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+	SHELL_CMD_ARG(busy_stat, NULL, "print radio BUSY wait statistics, -c to clear",
+		      cmd_sid_print_busy_stats, 1, 1),
+#endif
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+	SHELL_CMD_ARG(spi_stat, NULL, "print radio SPI bus statistics, -c to clear",
+		      cmd_sid_print_spi_stats, 1, 1),
+#endif
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+	SHELL_CMD_ARG(radio_cache_stat, NULL,
+		      "print radio configuration cache statistics, -c to clear",
+		      cmd_sid_print_radio_cache_stats, 1, 1),
+#endif
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	SHELL_CMD_ARG(kv_stat, NULL, "print key-value storage statistics, -c to clear",
+		      cmd_sid_print_kv_stats, 1, 1),
+#endif
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+	SHELL_CMD_ARG(dfu_stat, NULL, "print dfu image write statistics, -c to clear",
+		      cmd_sid_print_dfu_img_stats, 1, 1),
 #endif
 	SHELL_SUBCMD_SET_END);
 
@@ -1559,3 +1610,243 @@ int cmd_sid_print_heap_stats(const struct shell *shell, int32_t argc, const char
 	return 0;
 }
 #endif
+
+#ifdef CONFIG_SIDEWALK_HEAP_POOL_STATS
+int cmd_sid_print_mem_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	if (argc == 2 && strcmp(argv[1], "-c")) {
+		return -EINVAL;
+	}
+
+	struct sid_hal_memory_stats stats;
+
+	sid_hal_memory_stats_get(&stats);
+	shell_info(shell, "%-8s %9s %8s %10s %8s %7s", "block", "used", "max", "allocs", "full",
+		   "unused");
+	for (int i = 0; i < SID_HAL_MEMORY_POOLS; i++) {
+		const struct sid_hal_memory_pool_stats *pool = &stats.pools[i];
+		const uint64_t served = (uint64_t)pool->allocs * pool->block_size;
+
+		shell_info(shell, "%-8u %4u/%-4u %8u %10u %8u %6u%%", pool->block_size, pool->used,
+			   pool->blocks, pool->used_max, pool->allocs, pool->full,
+			   served ? (uint32_t)(pool->unused_bytes * 100ULL / served) : 0);
+	}
+	shell_info(shell, "heap allocs %u, failed %u (%u fragmented), free %u B, max used %u B",
+		   stats.heap_allocs, stats.heap_failures, stats.heap_fragmented, stats.heap_free,
+		   stats.heap_used_max);
+	if (argc == 2) {
+		sid_hal_memory_stats_reset();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_HEAP_POOL_STATS */
+
+#if defined(CONFIG_SIDEWALK_TIMER_STATS) || defined(CONFIG_SIDEWALK_TIMER_LATENCY_STATS)
+int cmd_sid_print_timer_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	bool clear = false;
+
+	if (argc == 2) {
+		if (strcmp(argv[1], "-c")) {
+			return -EINVAL;
+		}
+		clear = true;
+	}
+
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	struct sid_timer_stats stats;
+
+	sid_timer_stats_get(&stats);
+	shell_info(shell,
+		   "armed %u, coalesced %u, aligned %u, reprograms %u (%u avoided), wakeups %u, "
+		   "expired %u (%u early)",
+		   stats.armed, stats.coalesced, stats.aligned, stats.reprograms,
+		   stats.reprograms_avoided, stats.wakeups, stats.expired, stats.expired_early);
+	if (clear) {
+		sid_timer_stats_reset();
+	}
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+
+#ifdef CONFIG_SIDEWALK_TIMER_LATENCY_STATS
+	struct sid_timer_latency_stats latency;
+
+	sid_timer_latency_stats_get(&latency);
+	shell_info(shell, "%-12s %10s %10s", "delay [us]", "fire", "dispatch");
+	for (int i = 0; i < SID_TIMER_LATENCY_BUCKETS; i++) {
+		const uint32_t lower = i ? BIT(i - 1) : 0;
+
+		if (i == SID_TIMER_LATENCY_BUCKETS - 1) {
+			shell_info(shell, ">= %-9u %10u %10u", lower, latency.fire_delay[i],
+				   latency.dispatch_delay[i]);
+		} else {
+			shell_info(shell, "< %-10u %10u %10u", (uint32_t)BIT(i),
+				   latency.fire_delay[i], latency.dispatch_delay[i]);
+		}
+	}
+	shell_info(shell, "%-12s %10u %10u", "max", latency.fire_delay_max_us,
+		   latency.dispatch_delay_max_us);
+	if (clear) {
+		sid_timer_latency_stats_reset();
+	}
+#endif /* CONFIG_SIDEWALK_TIMER_LATENCY_STATS */
+
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+int cmd_sid_print_critical_region_stats(const struct shell *shell, int32_t argc,
+					const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	if (argc == 2 && strcmp(argv[1], "-c")) {
+		return -EINVAL;
+	}
+
+	static struct sid_critical_region_stats stats;
+
+	sid_critical_region_stats_get(&stats);
+	shell_info(shell, "%-12s %10s %10s %6s", "site", "count", "max [us]", "depth");
+	for (uint32_t i = 0; i < stats.sites_used; i++) {
+		shell_info(shell, "0x%08lx   %10u %10u %6u", (unsigned long)stats.sites[i].site,
+			   stats.sites[i].count, stats.sites[i].max_hold_us,
+			   stats.sites[i].max_depth);
+	}
+	shell_info(shell, "max hold %u us, max depth %u, untracked %u", stats.max_hold_us,
+		   stats.max_depth, stats.untracked);
+	if (argc == 2) {
+		sid_critical_region_stats_reset();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+int cmd_sid_print_busy_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	if (argc == 2 && strcmp(argv[1], "-c")) {
+		return -EINVAL;
+	}
+
+	static struct semtech_busy_stats stats[CONFIG_SIDEWALK_SUBGHZ_BUSY_OPCODES];
+	const size_t count = semtech_busy_stats_get(stats, ARRAY_SIZE(stats));
+
+	shell_info(shell, "%-8s %10s %10s %10s %10s %12s", "opcode", "count", "blocked",
+		   "avg [us]", "max [us]", "total [us]");
+	for (size_t i = 0; i < count; i++) {
+		shell_info(shell, "0x%04x   %10u %10u %10u %10u %12llu", stats[i].opcode,
+			   stats[i].count, stats[i].blocked, stats[i].avg_us, stats[i].max_us,
+			   (unsigned long long)stats[i].total_us);
+	}
+	if (argc == 2) {
+		semtech_busy_stats_reset();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS */
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+int cmd_sid_print_spi_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	if (argc == 2 && strcmp(argv[1], "-c")) {
+		return -EINVAL;
+	}
+
+	struct sid_pal_serial_bus_stats stats;
+
+	sid_pal_serial_bus_stats_get(&stats);
+	shell_info(shell, "transfers %u, async %u, bytes %llu", stats.transfers,
+		   stats.async_transfers, (unsigned long long)stats.bytes);
+	shell_info(shell, "thread blocked %llu us, max %u us", (unsigned long long)stats.blocked_us,
+		   stats.max_blocked_us);
+	if (argc == 2) {
+		sid_pal_serial_bus_stats_reset();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+int cmd_sid_print_radio_cache_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	if (argc == 2 && strcmp(argv[1], "-c")) {
+		return -EINVAL;
+	}
+
+	struct semtech_cmd_cache_stats stats;
+
+	semtech_cmd_cache_stats_get(&stats);
+	shell_info(shell, "skipped %u, sent %u, invalidated %u", stats.hits, stats.misses,
+		   stats.invalidations);
+	if (argc == 2) {
+		semtech_cmd_cache_stats_reset();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+int cmd_sid_print_kv_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	if (argc == 2 && strcmp(argv[1], "-c")) {
+		return -EINVAL;
+	}
+
+	struct sid_storage_kv_stats stats;
+
+	sid_storage_kv_stats_get(&stats);
+	shell_info(shell, "set %u, avoided %u, flash writes %u, deletes %u, commits %u",
+		   stats.sets, stats.writes_avoided, stats.flash_writes, stats.flash_deletes,
+		   stats.commits);
+	shell_info(shell, "flushes %u, read hits %u, misses %u", stats.flushes, stats.read_hits,
+		   stats.read_misses);
+	if (argc == 2) {
+		sid_storage_kv_stats_reset();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
+
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+int cmd_sid_print_dfu_img_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	CHECK_ARGUMENT_COUNT(argc, 1, 1);
+
+	if (argc == 2 && strcmp(argv[1], "-c")) {
+		return -EINVAL;
+	}
+
+	struct nordic_dfu_img_stats stats;
+
+	nordic_dfu_img_stats_get(&stats);
+	shell_info(shell, "written %u B in %u flushes, %u writes waited", stats.bytes,
+		   stats.flushes, stats.deferred);
+	shell_info(shell, "elapsed %u ms, %u B/s", stats.elapsed_ms, stats.bytes_per_s);
+	shell_info(shell, "flash %u us, max %u us, %u B/s", stats.flash_time_us,
+		   stats.flash_time_max_us, stats.flash_bytes_per_s);
+	if (argc == 2) {
+		nordic_dfu_img_stats_reset();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_DFU_IMG_ASYNC */
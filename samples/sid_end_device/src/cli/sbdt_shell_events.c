@@ -8,6 +8,7 @@
 #include <cli/sbdt_shell.h>
 #include <sid_bulk_data_transfer_api.h>
 #include <sbdt/scratch_buffer.h>
+#include <sid_hal_memory_ifc.h>
 #include <json_printer/sidTypes2str.h>
 
 #include <zephyr/logging/log.h>
@@ -119,12 +120,21 @@ void sbdt_event_finalize_request_response(sidewalk_ctx_t *sid, void *ctx)
 
 void sbdt_event_release_buffer(sidewalk_ctx_t *sid, void *ctx)
 {
-	struct sbdt_buffer_release_ctx *release_event = ctx;
-	sid_error_t result = sid_bulk_data_transfer_release_buffer(
-		sid->handle, release_event->file_id, &release_event->transfer_buffer);
-	if (result != SID_ERROR_NONE) {
-		LOG_ERR("sid_bulk_data_transfer_release_buffer returned %d, (%s)", result,
-			SID_ERROR_T_STR(result));
+	sys_slist_t ready;
+	sys_snode_t *node;
+
+	/* Releasing the buffer acknowledges the fragment, it waits for the crc checkpoint */
+	sbdt_file_transfer_release_queue(ctx, &ready);
+	while ((node = sys_slist_get(&ready))) {
+		struct sbdt_buffer_release_ctx *release_event =
+			CONTAINER_OF(node, struct sbdt_buffer_release_ctx, node);
+		sid_error_t result = sid_bulk_data_transfer_release_buffer(
+			sid->handle, release_event->file_id, &release_event->transfer_buffer);
+		if (result != SID_ERROR_NONE) {
+			LOG_ERR("sid_bulk_data_transfer_release_buffer returned %d, (%s)", result,
+				SID_ERROR_T_STR(result));
+		}
+		LOG_INF("CMD: RELEASE BUFFER:  ERR: %d", result);
+		sid_hal_free(release_event);
 	}
-	LOG_INF("CMD: RELEASE BUFFER:  ERR: %d", result);
 }
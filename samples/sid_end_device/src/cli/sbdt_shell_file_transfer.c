@@ -24,6 +24,13 @@ LOG_MODULE_REGISTER(sid_sbdt_file_transfer, CONFIG_SIDEWALK_LOG_LEVEL);
 #define FILE_TRANSFER_CRC_GROUP 0xB
 #define FILE_TRANSFER_CRC_KEY 1
 
+/* Running CRC of the last transfer, saved every few fragments before they are acknowledged */
+struct file_transfer_checkpoint {
+	uint32_t file_id;
+	uint32_t offset;
+	uint32_t crc;
+};
+
 struct sbdt_file_info transfer_info[CONFIG_SBDT_MAX_PARALLEL_TRANSFERS] = {};
 
 struct sbdt_file_info *get_file_info_by_id(uint32_t file_id)
@@ -51,11 +58,103 @@ static struct sbdt_file_info *allocate_new_info_instance(uint32_t file_id)
 
 static void release_info_instance(struct sbdt_file_info *info)
 {
+	sys_snode_t *node;
+
 	if (info != NULL) {
+		/* the stack no longer holds the queued buffers */
+		while ((node = sys_slist_get(&info->unreleased))) {
+			sid_hal_free(CONTAINER_OF(node, struct sbdt_buffer_release_ctx, node));
+		}
 		memset(info, 0, sizeof(*info));
 	}
 }
 
+static void checkpoint_save(struct sbdt_file_info *info)
+{
+	struct file_transfer_checkpoint checkpoint = { .file_id = info->file_id,
+						       .offset = info->crc_offset,
+						       .crc = info->crc };
+
+	info->fragments_since_checkpoint = 0;
+	if (!info->crc_valid || info->checkpoint_offset == info->crc_offset) {
+		return;
+	}
+
+	sid_error_t result = sid_pal_storage_kv_record_set(
+		FILE_TRANSFER_CRC_GROUP, FILE_TRANSFER_CRC_KEY, &checkpoint, sizeof(checkpoint));
+	if (result != SID_ERROR_NONE) {
+		LOG_ERR("COULD NOT STORE CRC: %x", info->crc);
+		return;
+	}
+	info->checkpoint_offset = info->crc_offset;
+}
+
+static void checkpoint_load(struct sbdt_file_info *info)
+{
+	struct file_transfer_checkpoint checkpoint = {};
+	sid_error_t result = sid_pal_storage_kv_record_get(
+		FILE_TRANSFER_CRC_GROUP, FILE_TRANSFER_CRC_KEY, &checkpoint, sizeof(checkpoint));
+	if (result != SID_ERROR_NONE || checkpoint.file_id != info->file_id) {
+		LOG_INF("CRC NOT FOUND IN FLASH!");
+		return;
+	}
+
+	info->crc = checkpoint.crc;
+	info->crc_offset = checkpoint.offset;
+	info->checkpoint_offset = checkpoint.offset;
+	info->crc_valid = true;
+	LOG_INF("SBDT CRC CHECKPOINT: OFFSET: 0x%x, CRC: 0x%x", info->crc_offset, info->crc);
+}
+
+static bool checkpoint_due(const struct sbdt_file_info *info)
+{
+	if (info->crc_offset == info->file_size) {
+		return true;
+	}
+	/* the sender waits for the acknowledgements when the scratch buffer is full */
+	if (info->block_size && info->fragments_since_checkpoint >=
+					MAX(info->minimum_scratch_buffer_size / info->block_size, 1)) {
+		return true;
+	}
+	if (CONFIG_SBDT_CRC_CHECKPOINT_FRAGMENTS &&
+	    info->fragments_since_checkpoint >= CONFIG_SBDT_CRC_CHECKPOINT_FRAGMENTS) {
+		return true;
+	}
+	return CONFIG_SBDT_CRC_CHECKPOINT_BYTES &&
+	       info->crc_offset - info->checkpoint_offset >= CONFIG_SBDT_CRC_CHECKPOINT_BYTES;
+}
+
+void sbdt_file_transfer_release_queue(struct sbdt_buffer_release_ctx *ctx, sys_slist_t *ready)
+{
+	struct sbdt_file_info *info = get_file_info_by_id(ctx->file_id);
+
+	sys_slist_init(ready);
+	if (!info) {
+		sys_slist_append(ready, &ctx->node);
+		return;
+	}
+
+	sys_slist_append(&info->unreleased, &ctx->node);
+	info->fragments_since_checkpoint++;
+	if (!checkpoint_due(info)) {
+		return;
+	}
+
+	/* if the write fails, a transfer resumed after a reboot reports the crc not verified */
+	checkpoint_save(info);
+	*ready = info->unreleased;
+	sys_slist_init(&info->unreleased);
+}
+
+void sbdt_file_transfer_checkpoint(void)
+{
+	for (size_t i = 0; i < CONFIG_SBDT_MAX_PARALLEL_TRANSFERS; i++) {
+		if (transfer_info[i].is_consumed) {
+			checkpoint_save(&transfer_info[i]);
+		}
+	}
+}
+
 void on_sbdt_transfer_request(const struct sid_bulk_data_transfer_request *const transfer_request,
 			      struct sid_bulk_data_transfer_response *const transfer_response,
 			      void *context)
@@ -100,6 +199,11 @@ void on_sbdt_transfer_request(const struct sid_bulk_data_transfer_request *const
 	}
 
 	info->file_size = transfer_request->file_size;
+	info->crc_valid = (transfer_request->file_offset == 0);
+	if (transfer_request->file_offset) {
+		/* resumed transfer, continue the crc from the last checkpoint */
+		checkpoint_load(info);
+	}
 	info->block_size = transfer_request->fragment_size;
 	info->minimum_scratch_buffer_size = transfer_request->minimum_scratch_buffer_size;
 	info->file_descriptor_size = transfer_request->file_descriptor_size;
@@ -131,7 +235,8 @@ static void on_sbdt_data_received_delayed(struct k_timer *timer)
 {
 	struct sbdt_buffer_release_ctx *ctx =
 		CONTAINER_OF(timer, struct sbdt_buffer_release_ctx, delay);
-	sidewalk_event_send(sbdt_event_release_buffer, ctx, sid_hal_free);
+	/* the release event keeps the ctx until the buffer is released */
+	sidewalk_event_send(sbdt_event_release_buffer, ctx, NULL);
 }
 
 static void on_sbdt_data_received_stopped(struct k_timer *timer)
@@ -161,31 +266,36 @@ void on_sbdt_data_received(const struct sid_bulk_data_transfer_desc *const desc,
 	}
 	if (desc->file_offset == 0) {
 		sid_pal_storage_kv_group_delete(FILE_TRANSFER_CRC_GROUP);
+		info->crc = 0;
+		info->crc_offset = 0;
+		info->checkpoint_offset = 0;
+		info->crc_valid = true;
 	}
-	uint32_t crc = 0;
-	sid_error_t result = sid_pal_storage_kv_record_get(
-		FILE_TRANSFER_CRC_GROUP, FILE_TRANSFER_CRC_KEY, &crc, sizeof(uint32_t));
-	if (result == SID_ERROR_NOT_FOUND) {
-		LOG_INF("CRC NOT FOUND IN FLASH!");
-	} else if (result != SID_ERROR_NONE) {
-		LOG_INF("CRC COULD NOT BE LOADED");
-	}
-	info->crc = crc;
 
 	LOG_INF("SBDT PREV CRC: 0x%x", info->crc);
 	info->file_offset = desc->file_offset;
-	info->crc = crc32_ieee_update(info->crc, buffer->data, buffer->size);
-	if (info->file_size == info->file_offset + buffer->size) {
-		LOG_INF("EVENT SBDT FILE RECEIVED: FILE_ID: %x, FILE_SIZE: %u, FILE_CRC: 0x%x",
-			info->file_id, info->file_size, info->crc);
+	uint32_t fragment_end = desc->file_offset + buffer->size;
+	if (desc->file_offset > info->crc_offset) {
+		if (info->crc_valid) {
+			LOG_WRN("SBDT CRC AT OFFSET 0x%x, FRAGMENT AT 0x%x, CRC CAN NOT BE VERIFIED",
+				info->crc_offset, desc->file_offset);
+		}
+		info->crc_valid = false;
+	} else if (fragment_end > info->crc_offset) {
+		/* a resumed transfer may repeat a part of the file already in the crc */
+		uint32_t skip = info->crc_offset - desc->file_offset;
+		info->crc = crc32_ieee_update(info->crc, (uint8_t *)buffer->data + skip,
+					      buffer->size - skip);
+		info->crc_offset = fragment_end;
+	}
+
+	if (info->file_size == fragment_end) {
+		LOG_INF("EVENT SBDT FILE RECEIVED: FILE_ID: %x, FILE_SIZE: %u, FILE_CRC: 0x%x%s",
+			info->file_id, info->file_size, info->crc,
+			info->crc_valid ? "" : " (NOT VERIFIED)");
 	} else {
 		LOG_INF("EVENT SBDT UPDATED CRC: 0x%x", info->crc);
 	}
-	result = sid_pal_storage_kv_record_set(FILE_TRANSFER_CRC_GROUP, FILE_TRANSFER_CRC_KEY,
-					       &info->crc, sizeof(info->crc));
-	if (result != SID_ERROR_NONE) {
-		LOG_ERR("COULD NOT STORE CRC: %x", info->crc);
-	}
 	uint8_t *tmp = buffer->data;
 	for (size_t i = 0; i < buffer->size; i += 217) {
 		if (i + 217 > buffer->size) {
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sbdt/dfu_block_map.h>
+#include <sid_pal_storage_kv_ifc.h>
+
+#include <errno.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(dfu_block_map, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define BLOCK_MAP_GROUP 0xC
+#define BLOCK_MAP_HEADER_KEY 0
+#define BLOCK_MAP_CHUNK_KEY(chunk) (1 + (chunk))
+
+#define BLOCK_MAP_CHUNKS (sizeof(((struct dfu_block_map *)0)->bits) / DFU_BLOCK_MAP_CHUNK_SIZE)
+
+BUILD_ASSERT(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_BITMAP_SIZE % DFU_BLOCK_MAP_CHUNK_SIZE == 0,
+	     "bitmap is saved in whole chunks");
+BUILD_ASSERT(BLOCK_MAP_CHUNKS <= 32, "dirty chunks are tracked in 32 bits");
+BUILD_ASSERT(DFU_BLOCK_MAP_CHUNK_SIZE <= SID_PAL_KV_STORE_MAX_LENGTH_BYTES);
+
+struct block_map_header {
+	uint32_t file_id;
+	uint32_t file_size;
+	uint32_t block_size;
+};
+
+static size_t chunks_used(const struct dfu_block_map *map)
+{
+	return DIV_ROUND_UP(DIV_ROUND_UP(map->block_count, 8), DFU_BLOCK_MAP_CHUNK_SIZE);
+}
+
+static bool bit_test(const struct dfu_block_map *map, uint32_t block)
+{
+	return map->bits[block / 8] & BIT(block % 8);
+}
+
+static int restore(struct dfu_block_map *map)
+{
+	struct block_map_header header = {};
+	sid_error_t e = sid_pal_storage_kv_record_get(BLOCK_MAP_GROUP, BLOCK_MAP_HEADER_KEY,
+						      &header, sizeof(header));
+	if (e != SID_ERROR_NONE || header.file_id != map->file_id ||
+	    header.file_size != map->file_size || header.block_size != map->block_size) {
+		return 0;
+	}
+
+	for (size_t chunk = 0; chunk < chunks_used(map); chunk++) {
+		/* a chunk never saved has no fragments */
+		(void)sid_pal_storage_kv_record_get(BLOCK_MAP_GROUP, BLOCK_MAP_CHUNK_KEY(chunk),
+						    &map->bits[chunk * DFU_BLOCK_MAP_CHUNK_SIZE],
+						    DFU_BLOCK_MAP_CHUNK_SIZE);
+	}
+	for (uint32_t block = 0; block < map->block_count; block++) {
+		map->received += bit_test(map, block);
+	}
+	return 1;
+}
+
+int dfu_block_map_open(struct dfu_block_map *map, uint32_t file_id, uint32_t file_size,
+		       uint32_t block_size)
+{
+	if (!map || !file_size || !block_size) {
+		return -EINVAL;
+	}
+
+	uint32_t block_count = DIV_ROUND_UP(file_size, block_size);
+	if (block_count > sizeof(map->bits) * 8) {
+		LOG_ERR("file of %u fragments, map for %u", block_count,
+			(uint32_t)sizeof(map->bits) * 8);
+		return -EFBIG;
+	}
+
+	*map = (struct dfu_block_map){ .file_id = file_id,
+				       .file_size = file_size,
+				       .block_size = block_size,
+				       .block_count = block_count };
+	if (restore(map)) {
+		LOG_INF("resumed file %x, %u of %u fragments", file_id, map->received,
+			block_count);
+		return 1;
+	}
+
+	(void)sid_pal_storage_kv_group_delete(BLOCK_MAP_GROUP);
+	struct block_map_header header = { .file_id = file_id,
+					   .file_size = file_size,
+					   .block_size = block_size };
+	sid_error_t e = sid_pal_storage_kv_record_set(BLOCK_MAP_GROUP, BLOCK_MAP_HEADER_KEY,
+						      &header, sizeof(header));
+	if (e != SID_ERROR_NONE) {
+		/* the transfer goes on, it just does not resume */
+		LOG_WRN("block map header save fail %d", e);
+	}
+	return 0;
+}
+
+bool dfu_block_map_test(const struct dfu_block_map *map, uint32_t offset)
+{
+	uint32_t block = offset / map->block_size;
+	return block < map->block_count && bit_test(map, block);
+}
+
+bool dfu_block_map_any(const struct dfu_block_map *map, uint32_t start, uint32_t end)
+{
+	uint32_t last = MIN(DIV_ROUND_UP(end, map->block_size), map->block_count);
+
+	for (uint32_t block = start / map->block_size; block < last; block++) {
+		if (bit_test(map, block)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int dfu_block_map_set(struct dfu_block_map *map, uint32_t offset)
+{
+	uint32_t block = offset / map->block_size;
+	if (offset % map->block_size || block >= map->block_count) {
+		return -EINVAL;
+	}
+	if (bit_test(map, block)) {
+		return 0;
+	}
+
+	map->bits[block / 8] |= BIT(block % 8);
+	map->received++;
+	map->dirty_chunks |= BIT(block / 8 / DFU_BLOCK_MAP_CHUNK_SIZE);
+	map->blocks_since_save++;
+
+	if (map->blocks_since_save >= CONFIG_SIDEWALK_FILE_TRANSFER_DFU_SAVE_FRAGMENTS ||
+	    dfu_block_map_complete(map)) {
+		return dfu_block_map_save(map);
+	}
+	return 0;
+}
+
+int dfu_block_map_save(struct dfu_block_map *map)
+{
+	int err = 0;
+
+	for (size_t chunk = 0; chunk < BLOCK_MAP_CHUNKS; chunk++) {
+		if (!(map->dirty_chunks & BIT(chunk))) {
+			continue;
+		}
+		sid_error_t e = sid_pal_storage_kv_record_set(
+			BLOCK_MAP_GROUP, BLOCK_MAP_CHUNK_KEY(chunk),
+			&map->bits[chunk * DFU_BLOCK_MAP_CHUNK_SIZE], DFU_BLOCK_MAP_CHUNK_SIZE);
+		if (e != SID_ERROR_NONE) {
+			LOG_ERR("block map chunk %u save fail %d", (uint32_t)chunk, e);
+			err = -EIO;
+			continue;
+		}
+		map->dirty_chunks &= ~BIT(chunk);
+	}
+	map->blocks_since_save = 0;
+	return err;
+}
+
+void dfu_block_map_clear(struct dfu_block_map *map)
+{
+	(void)sid_pal_storage_kv_group_delete(BLOCK_MAP_GROUP);
+	*map = (struct dfu_block_map){ 0 };
+}
+
+uint32_t dfu_block_map_first_missing(const struct dfu_block_map *map)
+{
+	for (uint32_t block = 0; block < map->block_count; block++) {
+		if (!bit_test(map, block)) {
+			return block * map->block_size;
+		}
+	}
+	return map->file_size;
+}
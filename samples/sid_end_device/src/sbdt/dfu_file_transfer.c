@@ -14,53 +14,319 @@
 #include <sid_bulk_data_transfer_api.h>
 #include <zephyr/logging/log.h>
 #include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_ext.h>
 #include <stdio.h>
+#include <errno.h>
 #if defined(CONFIG_SIDEWALK_DFU_SERVICE_BLE)
 #include <sidewalk_dfu/nordic_dfu.h>
 #endif
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+#include <sbdt/dfu_block_map.h>
+#include <sbdt/dfu_slot.h>
+#endif
 
 LOG_MODULE_REGISTER(file_transfer, CONFIG_SIDEWALK_LOG_LEVEL);
 
-void sidewalk_event_file_transfer(sidewalk_ctx_t *sid, void *ctx)
+#define IMAGE_HASH_SIZE 32
+
+/* SHA-256 of the image, computed while the fragments come in order */
+static struct {
+	struct sid_pal_crypto_hash_ctx ctx;
+	uint32_t file_id;
+	uint32_t file_size;
+	uint32_t hashed;
+	bool active;
+} image_hash;
+
+static void image_hash_start(const struct sid_bulk_data_transfer_request *const request)
 {
-	sidewalk_transfer_t *transfer = (sidewalk_transfer_t *)ctx;
-	if (!transfer) {
-		LOG_ERR("File transfer event data is NULL");
+	if (image_hash.active) {
+		sid_pal_crypto_hash_abort(&image_hash.ctx);
+	}
+	image_hash.file_id = request->file_id;
+	image_hash.file_size = request->file_size;
+	image_hash.hashed = 0;
+
+	sid_error_t e = sid_pal_crypto_hash_start(&image_hash.ctx, SID_PAL_HASH_SHA256);
+	image_hash.active = (e == SID_ERROR_NONE);
+	if (e != SID_ERROR_NONE) {
+		LOG_ERR("image hash start fail %s", SID_ERROR_T_STR(e));
+	}
+}
+
+static void image_hash_stop(void)
+{
+	if (image_hash.active) {
+		sid_pal_crypto_hash_abort(&image_hash.ctx);
+		image_hash.active = false;
+	}
+}
+
+static void image_hash_update(const sidewalk_transfer_t *transfer)
+{
+	if (!image_hash.active || transfer->file_id != image_hash.file_id ||
+	    transfer->file_offset + transfer->data_size <= image_hash.hashed) {
+		return;
+	}
+	if (transfer->file_offset != image_hash.hashed) {
+		LOG_WRN("image hash stopped, fragment at %u after %u bytes hashed",
+			transfer->file_offset, image_hash.hashed);
+		image_hash_stop();
 		return;
 	}
 
-	LOG_INF("Received file Id %d; buffer size %d; file offset %d", transfer->file_id,
-		transfer->data_size, transfer->file_offset);
+	sid_error_t e =
+		sid_pal_crypto_hash_update(&image_hash.ctx, transfer->data, transfer->data_size);
+	if (e != SID_ERROR_NONE) {
+		LOG_ERR("image hash update fail %s", SID_ERROR_T_STR(e));
+		image_hash.active = false;
+		return;
+	}
+	image_hash.hashed += transfer->data_size;
+}
 
-	// print data hash
-	uint8_t hash_out[32];
-	sid_pal_hash_params_t params = { .algo = SID_PAL_HASH_SHA256,
-					 .data = transfer->data,
-					 .data_size = transfer->data_size,
-					 .digest = hash_out,
-					 .digest_size = sizeof(hash_out) };
+static void image_hash_finish(uint32_t file_id)
+{
+	uint8_t hash_out[IMAGE_HASH_SIZE];
 
-	sid_error_t e = sid_pal_crypto_hash(&params);
+	if (!image_hash.active || file_id != image_hash.file_id ||
+	    image_hash.hashed != image_hash.file_size) {
+		LOG_INF("image SHA256 not computed, fragments were not received in order");
+		image_hash_stop();
+		return;
+	}
+
+	image_hash.active = false;
+	sid_error_t e = sid_pal_crypto_hash_finish(&image_hash.ctx, hash_out, sizeof(hash_out));
 	if (e != SID_ERROR_NONE) {
-		LOG_ERR("Failed to hash received file transfer with error %s", SID_ERROR_T_STR(e));
-	} else {
+		LOG_ERR("image hash finish fail %s", SID_ERROR_T_STR(e));
+		return;
+	}
 #define HEX_PRINTER(a, ...) "%02X"
 #define HEX_PRINTER_ARG(a, ...) hash_out[a]
-		char hex_str[sizeof(hash_out) * 2 + 1] = { 0 };
-		snprintf(hex_str, sizeof(hex_str), LISTIFY(32, HEX_PRINTER, ()),
-			 LISTIFY(32, HEX_PRINTER_ARG, (, )));
-		LOG_INF("SHA256: %s", hex_str);
+	char hex_str[sizeof(hash_out) * 2 + 1] = { 0 };
+	snprintf(hex_str, sizeof(hex_str), LISTIFY(IMAGE_HASH_SIZE, HEX_PRINTER, ()),
+		 LISTIFY(IMAGE_HASH_SIZE, HEX_PRINTER_ARG, (, )));
+	LOG_INF("image SHA256: %s", hex_str);
+}
+
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+static struct dfu_block_map block_map;
+
+static void file_transfer_release(struct sid_handle *handle, const sidewalk_transfer_t *transfer);
+
+/* Fragment written to the slot, releasing the buffer acknowledges it to the sender */
+struct unsaved_transfer {
+	sys_snode_t node;
+	sidewalk_transfer_t transfer;
+};
+
+/* fragments not in the saved map yet, released once a save covers them */
+static sys_slist_t unsaved_transfers = SYS_SLIST_STATIC_INIT(&unsaved_transfers);
+static uint32_t unsaved_count;
+/* the scratch buffer of the stack holds this many fragments, more are never held */
+static uint32_t unsaved_max;
+
+static void dfu_resumable_release(struct sid_handle *handle)
+{
+	sys_snode_t *node;
+
+	while ((node = sys_slist_get(&unsaved_transfers))) {
+		struct unsaved_transfer *held = CONTAINER_OF(node, struct unsaved_transfer, node);
+
+		if (handle) {
+			file_transfer_release(handle, &held->transfer);
+		}
+		sid_hal_free(held);
 	}
+	unsaved_count = 0;
+}
 
-	int err = nordic_dfu_img_write(transfer->file_offset, transfer->data, transfer->data_size);
+static int dfu_resumable_open(const struct sid_bulk_data_transfer_request *const request,
+			      enum sid_bulk_data_transfer_reject_reason *reason)
+{
+	*reason = SID_BULK_DATA_TRANSFER_REJECT_REASON_GENERIC;
+	int err = dfu_slot_open();
+	if (err) {
+		return err;
+	}
+	if (request->file_size > dfu_slot_size()) {
+		LOG_ERR("file size %u, slot size %u", request->file_size,
+			(uint32_t)dfu_slot_size());
+		*reason = SID_BULK_DATA_TRANSFER_REJECT_REASON_FILE_TOO_BIG;
+		return -EFBIG;
+	}
+	/* fragments are written at their offset, only the last one can be padded */
+	if (request->fragment_size % dfu_slot_align()) {
+		LOG_ERR("fragment size %u not aligned to %u", request->fragment_size,
+			(uint32_t)dfu_slot_align());
+		*reason = SID_BULK_DATA_TRANSFER_REJECT_REASON_INVALID_FRAGMENT_SIZE;
+		return -EINVAL;
+	}
+
+	/* buffers of the previous transfer are no longer held by the stack */
+	dfu_resumable_release(NULL);
+	unsaved_max = MIN(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_SAVE_FRAGMENTS,
+			  request->minimum_scratch_buffer_size / request->fragment_size);
+
+	err = dfu_block_map_open(&block_map, request->file_id, request->file_size,
+				 request->fragment_size);
+	if (err < 0) {
+		*reason = err == -EFBIG ? SID_BULK_DATA_TRANSFER_REJECT_REASON_FILE_TOO_BIG :
+					  SID_BULK_DATA_TRANSFER_REJECT_REASON_GENERIC;
+		return err;
+	}
+
+	/* the sender skips the fragments below the offset, they must be in the saved map */
+	uint32_t first_missing = err ? dfu_block_map_first_missing(&block_map) : 0;
+	if (request->file_offset > first_missing) {
+		LOG_ERR("transfer starts at %u, first missing offset %u", request->file_offset,
+			first_missing);
+		/* start over, the next request of the file begins at offset 0 */
+		dfu_block_map_clear(&block_map);
+		return -ESPIPE;
+	}
+	if (err == 0) {
+		return dfu_slot_prepare();
+	}
+	LOG_INF("dfu resumed, first missing offset %u", first_missing);
+	return 0;
+}
 
+static int dfu_resumable_write(const sidewalk_transfer_t *transfer)
+{
+	if (!block_map.block_count || transfer->file_id != block_map.file_id) {
+		return -EINVAL;
+	}
+	if (dfu_block_map_test(&block_map, transfer->file_offset)) {
+		LOG_DBG("fragment at %u already written", transfer->file_offset);
+		return 0;
+	}
+
+	uint32_t progress = block_map.received * 10 / block_map.block_count;
+	int err = dfu_slot_write(&block_map, transfer->file_offset, transfer->data,
+				 transfer->data_size);
+	if (err) {
+		return err;
+	}
+	err = dfu_block_map_set(&block_map, transfer->file_offset);
+	if (err) {
+		return err;
+	}
+	if (block_map.received * 10 / block_map.block_count != progress) {
+		LOG_INF("dfu progress %u%%, %u of %u fragments",
+			block_map.received * 100 / block_map.block_count, block_map.received,
+			block_map.block_count);
+	}
+	return 0;
+}
+
+/*
+ * Releasing the buffer acknowledges the fragment, and a transfer resumed after a reboot
+ * starts after the last fragment acknowledged. A fragment is held until the map is saved
+ * with it, returns -EINPROGRESS if it is held, 0 if it is released by the caller.
+ */
+static int dfu_resumable_hold(struct sid_handle *handle, const sidewalk_transfer_t *transfer)
+{
+	if (block_map.dirty_chunks && unsaved_count + 1 < unsaved_max) {
+		struct unsaved_transfer *held =
+			(struct unsaved_transfer *)sid_hal_malloc(sizeof(struct unsaved_transfer));
+		if (held) {
+			held->transfer = *transfer;
+			sys_slist_append(&unsaved_transfers, &held->node);
+			unsaved_count++;
+			return -EINPROGRESS;
+		}
+	}
+
+	/* no more room to hold fragments, they are acknowledged after the map is saved */
+	int err = dfu_block_map_save(&block_map);
+	if (err) {
+		return err;
+	}
+	dfu_resumable_release(handle);
+	return 0;
+}
+
+void dfu_file_transfer_checkpoint(void)
+{
+	if (block_map.block_count) {
+		(void)dfu_block_map_save(&block_map);
+	}
+}
+#endif /* CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE */
+
+static void file_transfer_release(struct sid_handle *handle, const sidewalk_transfer_t *transfer)
+{
+	const struct sid_bulk_data_transfer_buffer sbdt_buffer = {
+		.data = transfer->data,
+		.size = transfer->data_size,
+	};
+	sid_error_t e = sid_bulk_data_transfer_release_buffer(handle, transfer->file_id,
+							      &sbdt_buffer);
+	if (e != SID_ERROR_NONE) {
+		LOG_ERR("sbdt release ret %s", SID_ERROR_T_STR(e));
+	}
+}
+
+#if defined(CONFIG_SIDEWALK_DFU_IMG_ASYNC) && !defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+#define RELEASE_RETRY_MS 10
+
+/* Fragment given to the image writer, the buffer is held by the stack until the data was copied */
+struct async_transfer {
+	/* first word, links the held fragments or the releases not sent */
+	sys_snode_t node;
+	sidewalk_transfer_t transfer;
+};
+
+/* fragments the image writer had no room for, in order, used in the Sidewalk thread only */
+static sys_slist_t held_transfers = SYS_SLIST_STATIC_INIT(&held_transfers);
+/* fragments copied by the image writer, the release event did not fit in the Sidewalk queue */
+static K_QUEUE_DEFINE(unsent_releases);
+
+static void release_retry_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(release_retry_work, release_retry_handler);
+
+static void dfu_async_write(sidewalk_ctx_t *sid);
+
+/* Release the held fragments of a cancelled image */
+static void dfu_async_drop(struct sid_handle *handle)
+{
+	struct async_transfer *write;
+	sys_snode_t *node;
+
+	(void)k_work_cancel_delayable(&release_retry_work);
+	while ((write = k_queue_get(&unsent_releases, K_NO_WAIT))) {
+		file_transfer_release(handle, &write->transfer);
+		sid_hal_free(write);
+	}
+	while ((node = sys_slist_get(&held_transfers))) {
+		write = CONTAINER_OF(node, struct async_transfer, node);
+
+		file_transfer_release(handle, &write->transfer);
+		sid_hal_free(write);
+	}
+}
+#endif /* CONFIG_SIDEWALK_DFU_IMG_ASYNC && !CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE */
+
+static void file_transfer_written(sidewalk_ctx_t *sid, const sidewalk_transfer_t *transfer, int err)
+{
 	if (err) {
 		LOG_ERR("Fail to write img %d", err);
+#if !defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
 		err = nordic_dfu_img_cancel();
 		if (err) {
 			LOG_ERR("Fail to complete dfu %d", err);
 		}
-		e = sid_bulk_data_transfer_cancel(
+#endif
+#if defined(CONFIG_SIDEWALK_DFU_IMG_ASYNC) && !defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+		dfu_async_drop(sid->handle);
+#endif
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+		dfu_resumable_release(sid->handle);
+#endif
+		image_hash_stop();
+		sid_error_t e = sid_bulk_data_transfer_cancel(
 			sid->handle, transfer->file_id,
 			SID_BULK_DATA_TRANSFER_REJECT_REASON_FILE_TOO_BIG);
 		if (e != SID_ERROR_NONE) {
@@ -68,16 +334,122 @@ void sidewalk_event_file_transfer(sidewalk_ctx_t *sid, void *ctx)
 		}
 	}
 
-	const struct sid_bulk_data_transfer_buffer sbdt_buffer = {
-		.data = transfer->data,
-		.size = transfer->data_size,
-	};
-	e = sid_bulk_data_transfer_release_buffer(sid->handle, transfer->file_id, &sbdt_buffer);
-	if (e != SID_ERROR_NONE) {
-		LOG_ERR("sbdt release ret %s", SID_ERROR_T_STR(e));
+	file_transfer_release(sid->handle, transfer);
+}
+
+#if defined(CONFIG_SIDEWALK_DFU_IMG_ASYNC) && !defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+static void sidewalk_event_file_transfer_release(sidewalk_ctx_t *sid, void *ctx)
+{
+	file_transfer_release(sid->handle, &((struct async_transfer *)ctx)->transfer);
+	/* a write completed, the image writer has room for the held fragments */
+	dfu_async_write(sid);
+}
+
+static void release_retry_handler(struct k_work *work)
+{
+	void *write;
+
+	while ((write = k_queue_get(&unsent_releases, K_NO_WAIT))) {
+		int ret = sidewalk_event_send(sidewalk_event_file_transfer_release, write,
+					      sid_hal_free);
+		if (ret) {
+			k_queue_prepend(&unsent_releases, write);
+			(void)k_work_schedule(k_work_delayable_from_work(work),
+					      K_MSEC(RELEASE_RETRY_MS));
+			return;
+		}
+	}
+}
+
+static void on_img_write_done(void *ctx, int err)
+{
+	if (err) {
+		LOG_ERR("Fail to write img %d", err);
+	}
+	/* called from the dfu image work queue, the buffer is released in the Sidewalk thread */
+	int ret = sidewalk_event_send(sidewalk_event_file_transfer_release, ctx, sid_hal_free);
+	if (ret) {
+		/* the stack holds the buffer until it is released, send the event again later */
+		LOG_WRN("release event send ret %d, retry", ret);
+		k_queue_append(&unsent_releases, ctx);
+		(void)k_work_schedule(&release_retry_work, K_MSEC(RELEASE_RETRY_MS));
 	}
 }
 
+static int dfu_async_hold(const sidewalk_transfer_t *transfer)
+{
+	/* the buffer is held by the stack until the image writer took the data */
+	struct async_transfer *write =
+		(struct async_transfer *)sid_hal_malloc(sizeof(struct async_transfer));
+	if (!write) {
+		return -ENOMEM;
+	}
+	write->transfer = *transfer;
+
+	/* the image is written in order, a fragment waits behind the held ones */
+	sys_slist_append(&held_transfers, &write->node);
+	return 0;
+}
+
+/* Write the held fragments in order, until the image writer has no room for one */
+static void dfu_async_write(sidewalk_ctx_t *sid)
+{
+	sys_snode_t *node;
+
+	while ((node = sys_slist_get(&held_transfers))) {
+		struct async_transfer *write = CONTAINER_OF(node, struct async_transfer, node);
+		int err = nordic_dfu_img_write_async(write->transfer.file_offset,
+						     write->transfer.data,
+						     write->transfer.data_size, on_img_write_done,
+						     write);
+		if (err == -EINPROGRESS) {
+			continue;
+		}
+		if (err == -ENOBUFS) {
+			/* kept until a write completes, the stack holds its buffer meanwhile */
+			sys_slist_prepend(&held_transfers, node);
+			return;
+		}
+		file_transfer_written(sid, &write->transfer, err);
+		sid_hal_free(write);
+	}
+}
+#endif /* CONFIG_SIDEWALK_DFU_IMG_ASYNC && !CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE */
+
+void sidewalk_event_file_transfer(sidewalk_ctx_t *sid, void *ctx)
+{
+	sidewalk_transfer_t *transfer = (sidewalk_transfer_t *)ctx;
+	if (!transfer) {
+		LOG_ERR("File transfer event data is NULL");
+		return;
+	}
+
+	LOG_INF("Received file Id %d; buffer size %d; file offset %d", transfer->file_id,
+		transfer->data_size, transfer->file_offset);
+
+	image_hash_update(transfer);
+
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+	int err = dfu_resumable_write(transfer);
+	if (!err) {
+		err = dfu_resumable_hold(sid->handle, transfer);
+		if (err == -EINPROGRESS) {
+			return;
+		}
+	}
+#elif defined(CONFIG_SIDEWALK_DFU_IMG_ASYNC)
+	int err = dfu_async_hold(transfer);
+	if (!err) {
+		dfu_async_write(sid);
+		return;
+	}
+#else
+	int err = nordic_dfu_img_write(transfer->file_offset, transfer->data, transfer->data_size);
+#endif
+
+	file_transfer_written(sid, transfer, err);
+}
+
 static void on_transfer_request(const struct sid_bulk_data_transfer_request *const transfer_request,
 				struct sid_bulk_data_transfer_response *const transfer_response,
 				void *context)
@@ -88,17 +460,29 @@ static void on_transfer_request(const struct sid_bulk_data_transfer_request *con
 	LOG_HEXDUMP_INF(transfer_request->file_descriptor, transfer_request->file_descriptor_size,
 			"file_descriptor");
 
-	int dfu_err = nordic_dfu_img_init();
-	if (dfu_err) {
-		LOG_ERR("dfu img init fail %d", dfu_err);
+#if defined(CONFIG_SIDEWALK_DFU_SERVICE_BLE)
+	if (nordic_dfu_is_in_dfu()) {
+		LOG_INF("Did not accept sbdt as application is in DFU mode");
 		transfer_response->status = SID_BULK_DATA_TRANSFER_ACTION_REJECT;
 		transfer_response->reject_reason = SID_BULK_DATA_TRANSFER_REJECT_REASON_GENERIC;
 		transfer_response->scratch_buffer_size = 0;
 		return;
 	}
-#if defined(CONFIG_SIDEWALK_DFU_SERVICE_BLE)
-	if (nordic_dfu_is_in_dfu()) {
-		LOG_INF("Did not accept sbdt as application is in DFU mode");
+#endif
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+	enum sid_bulk_data_transfer_reject_reason reason;
+	int dfu_err = dfu_resumable_open(transfer_request, &reason);
+	if (dfu_err) {
+		LOG_ERR("dfu slot open fail %d", dfu_err);
+		transfer_response->status = SID_BULK_DATA_TRANSFER_ACTION_REJECT;
+		transfer_response->reject_reason = reason;
+		transfer_response->scratch_buffer_size = 0;
+		return;
+	}
+#else
+	int dfu_err = nordic_dfu_img_init();
+	if (dfu_err) {
+		LOG_ERR("dfu img init fail %d", dfu_err);
 		transfer_response->status = SID_BULK_DATA_TRANSFER_ACTION_REJECT;
 		transfer_response->reject_reason = SID_BULK_DATA_TRANSFER_REJECT_REASON_GENERIC;
 		transfer_response->scratch_buffer_size = 0;
@@ -106,6 +490,8 @@ static void on_transfer_request(const struct sid_bulk_data_transfer_request *con
 	}
 #endif
 
+	image_hash_start(transfer_request);
+
 	transfer_response->scratch_buffer = scratch_buffer_create(
 		transfer_request->file_id, transfer_request->minimum_scratch_buffer_size);
 
@@ -154,10 +540,15 @@ static void on_data_received(const struct sid_bulk_data_transfer_desc *const des
 	if (err) {
 		LOG_ERR("Event transfer err %d", err);
 		LOG_INF("Cancelig file transfer");
+#if !defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
 		err = nordic_dfu_img_cancel();
 		if (err) {
 			LOG_ERR("Fail to complete dfu %d", err);
 		}
+#if defined(CONFIG_SIDEWALK_DFU_IMG_ASYNC)
+		dfu_async_drop((struct sid_handle *)context);
+#endif
+#endif
 		sid_error_t ret =
 			sid_bulk_data_transfer_cancel((struct sid_handle *)context,
 						      transfer->file_id,
@@ -173,7 +564,33 @@ static void on_finalize_request(uint32_t file_id, void *context)
 {
 	printk(JSON_NEW_LINE(JSON_OBJ(JSON_NAME(
 		"on_finalize_request", JSON_OBJ(JSON_NAME("file_id", JSON_INT(file_id)))))));
+	image_hash_finish(file_id);
+
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+	enum sid_bulk_data_transfer_final_status status =
+		SID_BULK_DATA_TRANSFER_FINAL_STATUS_SUCCESS;
+	int err = 0;
+	if (!dfu_block_map_complete(&block_map) || file_id != block_map.file_id) {
+		LOG_ERR("dfu image incomplete, first missing offset %u",
+			dfu_block_map_first_missing(&block_map));
+		err = -ENODATA;
+	} else {
+		err = dfu_slot_finalize();
+	}
+	if (err) {
+		status = SID_BULK_DATA_TRANSFER_FINAL_STATUS_FAILURE;
+	}
 
+	sid_error_t ret =
+		sid_bulk_data_transfer_finalize((struct sid_handle *)context, file_id, status);
+	if (ret != SID_ERROR_NONE) {
+		LOG_ERR("sid_bulk_data_transfer_finalize returned %s", SID_ERROR_T_STR(ret));
+	}
+	if (err) {
+		return;
+	}
+	dfu_block_map_clear(&block_map);
+#else
 	// report transfer success
 	sid_error_t ret = sid_bulk_data_transfer_finalize(
 		(struct sid_handle *)context, file_id, SID_BULK_DATA_TRANSFER_FINAL_STATUS_SUCCESS);
@@ -187,6 +604,7 @@ static void on_finalize_request(uint32_t file_id, void *context)
 	if (err) {
 		LOG_ERR("dfu image finalize fail %d", err);
 	}
+#endif
 
 	err = sidewalk_event_send(sidewalk_event_reboot, NULL, NULL);
 	if (err) {
@@ -198,22 +616,42 @@ static void on_cancel_request(uint32_t file_id, void *context)
 {
 	printk(JSON_NEW_LINE(JSON_OBJ(JSON_NAME(
 		"on_cancel_request", JSON_OBJ(JSON_NAME("file_id", JSON_INT(file_id)))))));
+	image_hash_stop();
 
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+	/* keep the received fragments, a new request for the same file resumes */
+	dfu_file_transfer_checkpoint();
+	dfu_resumable_release((struct sid_handle *)context);
+#else
 	int err = nordic_dfu_img_cancel();
 	if (err) {
 		LOG_ERR("Fail to complete dfu %d", err);
 	}
+#if defined(CONFIG_SIDEWALK_DFU_IMG_ASYNC)
+	dfu_async_drop((struct sid_handle *)context);
+#endif
+#endif
 }
 
 static void on_error(uint32_t file_id, void *context)
 {
 	printk(JSON_NEW_LINE(JSON_OBJ(
 		JSON_NAME("on_error", JSON_OBJ(JSON_NAME("file_id", JSON_INT(file_id)))))));
+	image_hash_stop();
 
+#if defined(CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE)
+	/* keep the received fragments, a new request for the same file resumes */
+	dfu_file_transfer_checkpoint();
+	dfu_resumable_release((struct sid_handle *)context);
+#else
 	int err = nordic_dfu_img_cancel();
 	if (err) {
 		LOG_ERR("Fail to complete dfu %d", err);
 	}
+#if defined(CONFIG_SIDEWALK_DFU_IMG_ASYNC)
+	dfu_async_drop((struct sid_handle *)context);
+#endif
+#endif
 }
 
 static void on_release_scratch_buffer(uint32_t file_id, void *context)
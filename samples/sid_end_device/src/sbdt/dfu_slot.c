@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sbdt/dfu_slot.h>
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/dfu/mcuboot.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(dfu_slot, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define DFU_SLOT_ID FIXED_PARTITION_ID(slot1_partition)
+#define DFU_SLOT_ALIGN_MAX 32
+
+static const struct flash_area *slot;
+
+int dfu_slot_open(void)
+{
+	if (slot) {
+		return 0;
+	}
+
+	int err = flash_area_open(DFU_SLOT_ID, &slot);
+	if (err) {
+		LOG_ERR("slot open fail %d", err);
+		return err;
+	}
+	if (flash_area_align(slot) > DFU_SLOT_ALIGN_MAX) {
+		LOG_ERR("slot write alignment %u not supported", flash_area_align(slot));
+		flash_area_close(slot);
+		slot = NULL;
+		return -ENOTSUP;
+	}
+	return 0;
+}
+
+size_t dfu_slot_align(void)
+{
+	return flash_area_align(slot);
+}
+
+size_t dfu_slot_size(void)
+{
+	return slot->fa_size;
+}
+
+static int page_get(uint32_t offset, uint32_t *start, size_t *size)
+{
+	struct flash_pages_info info;
+	int err = flash_get_page_info_by_offs(flash_area_get_device(slot), slot->fa_off + offset,
+					      &info);
+	if (err) {
+		return err;
+	}
+	*start = info.start_offset - slot->fa_off;
+	*size = info.size;
+	return 0;
+}
+
+int dfu_slot_prepare(void)
+{
+	uint32_t start;
+	size_t size;
+
+	/* the image trailer is at the end of the slot, it must be erased for the upgrade request */
+	int err = page_get(slot->fa_size - 1, &start, &size);
+	if (!err) {
+		err = flash_area_erase(slot, start, size);
+	}
+	if (err) {
+		LOG_ERR("trailer erase fail %d", err);
+	}
+	return err;
+}
+
+int dfu_slot_write(const struct dfu_block_map *map, uint32_t offset, const uint8_t *data,
+		   size_t size)
+{
+	uint32_t start;
+	size_t page_size;
+	int err;
+
+	if (offset + size > slot->fa_size) {
+		return -EFBIG;
+	}
+
+	/* a page with a received fragment was erased before, a reset may leave others unerased */
+	for (uint32_t pos = offset; pos < offset + size; pos = start + page_size) {
+		err = page_get(pos, &start, &page_size);
+		if (err) {
+			return err;
+		}
+		if (!dfu_block_map_any(map, start, start + page_size)) {
+			err = flash_area_erase(slot, start, page_size);
+			if (err) {
+				LOG_ERR("erase at 0x%x fail %d", start, err);
+				return err;
+			}
+		}
+	}
+
+	size_t align = flash_area_align(slot);
+	size_t aligned = ROUND_DOWN(size, align);
+	if (aligned) {
+		err = flash_area_write(slot, offset, data, aligned);
+		if (err) {
+			return err;
+		}
+	}
+	if (aligned < size) {
+		uint8_t tail[DFU_SLOT_ALIGN_MAX];
+		memset(tail, flash_area_erased_val(slot), align);
+		memcpy(tail, data + aligned, size - aligned);
+		err = flash_area_write(slot, offset + aligned, tail, align);
+	}
+	return err;
+}
+
+int dfu_slot_finalize(void)
+{
+	struct mcuboot_img_header header;
+
+	int err = boot_read_bank_header(DFU_SLOT_ID, &header, sizeof(header));
+	if (err) {
+		LOG_ERR("no valid image in the slot %d", err);
+		return -EBADF;
+	}
+	LOG_INF("image version %u.%u.%u+%u, size %u", header.h.v1.sem_ver.major,
+		header.h.v1.sem_ver.minor, header.h.v1.sem_ver.revision,
+		header.h.v1.sem_ver.build_num, header.h.v1.image_size);
+
+	err = boot_request_upgrade(BOOT_UPGRADE_TEST);
+	if (err) {
+		LOG_ERR("upgrade request fail %d", err);
+	}
+	return err;
+}
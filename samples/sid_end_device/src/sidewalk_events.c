@@ -26,11 +26,17 @@
 #ifdef CONFIG_SID_END_DEVICE_PERSISTENT_LINK_MASK
 #include <settings_utils.h>
 #endif /* CONFIG_SID_END_DEVICE_PERSISTENT_LINK_MASK */
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+#include <sid_storage_kv_ext.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
 
 #ifdef CONFIG_SIDEWALK_FILE_TRANSFER_DFU
 #include <sbdt/dfu_file_transfer.h>
 #include <zephyr/dfu/mcuboot.h>
 #endif /* CONFIG_SIDEWALK_FILE_TRANSFER_DFU */
+#ifdef CONFIG_SIDEWALK_FILE_TRANSFER_SHELL
+#include <cli/sbdt_shell.h>
+#endif /* CONFIG_SIDEWALK_FILE_TRANSFER_SHELL */
 
 LOG_MODULE_REGISTER(sidewalk_events, CONFIG_SIDEWALK_LOG_LEVEL);
 
@@ -338,14 +344,32 @@ void sidewalk_event_exit(sidewalk_ctx_t *sid, void *ctx)
 	}
 #ifdef CONFIG_SIDEWALK_FILE_TRANSFER_DFU
 	app_file_transfer_demo_deinit(sid->handle);
+#endif
+#ifdef CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE
+	dfu_file_transfer_checkpoint();
+#endif
+#ifdef CONFIG_SIDEWALK_FILE_TRANSFER_SHELL
+	sbdt_file_transfer_checkpoint();
 #endif
 	(void)sid_process(sid->handle);
 	(void)sid_deinit(sid->handle);
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	(void)sid_storage_kv_flush();
+#endif
 }
 
 void sidewalk_event_reboot(sidewalk_ctx_t *sid, void *ctx)
 {
 	LOG_INF("Rebooting...");
+#ifdef CONFIG_SIDEWALK_FILE_TRANSFER_DFU_RESUMABLE
+	dfu_file_transfer_checkpoint();
+#endif
+#ifdef CONFIG_SIDEWALK_FILE_TRANSFER_SHELL
+	sbdt_file_transfer_checkpoint();
+#endif
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	(void)sid_storage_kv_flush();
+#endif
 	LOG_PANIC();
 	sys_reboot(SYS_REBOOT_WARM);
 }
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_HAL_MEMORY_EXT_H
+#define SID_HAL_MEMORY_EXT_H
+
+#include <stdint.h>
+
+/* Number of size classes in front of the Sidewalk heap. */
+#define SID_HAL_MEMORY_POOLS 4
+
+#ifdef CONFIG_SIDEWALK_HEAP_POOL_STATS
+struct sid_hal_memory_pool_stats {
+	/* size of a block of the class */
+	uint32_t block_size;
+	/* number of blocks of the class */
+	uint32_t blocks;
+	/* blocks allocated now */
+	uint32_t used;
+	/* most blocks allocated at once */
+	uint32_t used_max;
+	/* allocations served by the class */
+	uint32_t allocs;
+	/* allocations passed to the heap because all blocks were taken */
+	uint32_t full;
+	/* bytes of the served blocks not requested by the caller */
+	uint32_t unused_bytes;
+};
+
+struct sid_hal_memory_stats {
+	struct sid_hal_memory_pool_stats pools[SID_HAL_MEMORY_POOLS];
+	/* allocations served by the heap */
+	uint32_t heap_allocs;
+	/* heap allocations that failed */
+	uint32_t heap_failures;
+	/* failed heap allocations with enough free bytes in total, split into smaller chunks */
+	uint32_t heap_fragmented;
+	/* free bytes of the heap */
+	uint32_t heap_free;
+	/* most bytes allocated from the heap at once */
+	uint32_t heap_used_max;
+};
+
+/**
+ * @brief Get the counters of the Sidewalk memory pools and heap.
+ *
+ * @param stats - pointer to the statistics.
+ */
+void sid_hal_memory_stats_get(struct sid_hal_memory_stats *stats);
+
+/**
+ * @brief Reset the counters, the high-water marks start from the current usage.
+ */
+void sid_hal_memory_stats_reset(void);
+#endif /* CONFIG_SIDEWALK_HEAP_POOL_STATS */
+
+#endif /* SID_HAL_MEMORY_EXT_H */
@@ -14,10 +14,13 @@
  */
 
 #include <sid_hal_memory_ifc.h>
+#include <sid_hal_memory_ext.h>
 
 #include <zephyr/logging/log.h>
 #include <zephyr/kernel.h>
 #include <zephyr/sys/sys_heap.h>
+#include <stddef.h>
+#include <string.h>
 
 LOG_MODULE_REGISTER(hal_memory, CONFIG_SIDEWALK_LOG_LEVEL);
 
@@ -41,8 +44,144 @@ LOG_MODULE_REGISTER(hal_memory, CONFIG_SIDEWALK_LOG_LEVEL);
 	CONFIG_SID_HAL_PROTOCOL_MEMORY_SZ + CONFIG_SIDEWALK_HEAP_SIZE +                            \
 		CONFIG_SID_END_DEVICE_EVENT_HEAP_SIZE + CONFIG_SIDEWALK_FILE_TRANSFER_HEAP_SIZE
 
+/* Like malloc(), any allocation can hold a double or a uint64_t */
+#define MEM_ALIGN __alignof__(max_align_t)
+
 K_HEAP_DEFINE(sid_heap, HEAP_SIZE);
 
+#ifdef CONFIG_SIDEWALK_HEAP_POOLS
+#define POOL_BLOCK_SIZE(n) ROUND_UP(CONFIG_SIDEWALK_HEAP_POOL_##n##_BLOCK_SIZE, MEM_ALIGN)
+#define POOL_DEFINE(n)                                                                             \
+	K_MEM_SLAB_DEFINE_STATIC(sid_pool_##n, POOL_BLOCK_SIZE(n),                                 \
+				 CONFIG_SIDEWALK_HEAP_POOL_##n##_BLOCKS, MEM_ALIGN)
+
+POOL_DEFINE(1);
+POOL_DEFINE(2);
+POOL_DEFINE(3);
+POOL_DEFINE(4);
+
+BUILD_ASSERT(POOL_BLOCK_SIZE(1) < POOL_BLOCK_SIZE(2) && POOL_BLOCK_SIZE(2) < POOL_BLOCK_SIZE(3) &&
+		     POOL_BLOCK_SIZE(3) < POOL_BLOCK_SIZE(4),
+	     "Block sizes of the Sidewalk heap pools must grow");
+
+/* smallest block size first, an allocation takes the first class it fits in */
+static struct k_mem_slab *const pools[] = { &sid_pool_1, &sid_pool_2, &sid_pool_3, &sid_pool_4 };
+
+BUILD_ASSERT(ARRAY_SIZE(pools) == SID_HAL_MEMORY_POOLS);
+
+#ifdef CONFIG_SIDEWALK_HEAP_POOL_STATS
+static struct k_spinlock stats_lock;
+static struct sid_hal_memory_stats stats;
+
+static void pool_stats_alloc(size_t pool, size_t size)
+{
+	struct sid_hal_memory_pool_stats *p = &stats.pools[pool];
+	uint32_t used = k_mem_slab_num_used_get(pools[pool]);
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	p->allocs++;
+	p->unused_bytes += pools[pool]->info.block_size - size;
+	p->used_max = MAX(p->used_max, used);
+	k_spin_unlock(&stats_lock, key);
+}
+
+static void pool_stats_full(size_t pool)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.pools[pool].full++;
+	k_spin_unlock(&stats_lock, key);
+}
+
+static void heap_stats_alloc(void *ptr, size_t size)
+{
+	struct sys_memory_stats heap = {};
+	k_spinlock_key_t key;
+
+	if (ptr) {
+		key = k_spin_lock(&stats_lock);
+		stats.heap_allocs++;
+		k_spin_unlock(&stats_lock, key);
+		return;
+	}
+
+	sys_heap_runtime_stats_get(&sid_heap.heap, &heap);
+	key = k_spin_lock(&stats_lock);
+	stats.heap_failures++;
+	if (heap.free_bytes >= size) {
+		stats.heap_fragmented++;
+	}
+	k_spin_unlock(&stats_lock, key);
+}
+
+void sid_hal_memory_stats_get(struct sid_hal_memory_stats *out)
+{
+	struct sys_memory_stats heap = {};
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	*out = stats;
+	k_spin_unlock(&stats_lock, key);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pools); i++) {
+		out->pools[i].block_size = pools[i]->info.block_size;
+		out->pools[i].blocks = pools[i]->info.num_blocks;
+		out->pools[i].used = k_mem_slab_num_used_get(pools[i]);
+	}
+	sys_heap_runtime_stats_get(&sid_heap.heap, &heap);
+	out->heap_free = heap.free_bytes;
+	out->heap_used_max = heap.max_allocated_bytes;
+}
+
+void sid_hal_memory_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	memset(&stats, 0, sizeof(stats));
+	for (size_t i = 0; i < ARRAY_SIZE(pools); i++) {
+		stats.pools[i].used_max = k_mem_slab_num_used_get(pools[i]);
+	}
+	k_spin_unlock(&stats_lock, key);
+	sys_heap_runtime_stats_reset_max(&sid_heap.heap);
+}
+#else
+#define pool_stats_alloc(pool, size)
+#define pool_stats_full(pool)
+#endif /* CONFIG_SIDEWALK_HEAP_POOL_STATS */
+
+static void *pool_alloc(size_t size)
+{
+	void *ptr;
+
+	for (size_t i = 0; i < ARRAY_SIZE(pools); i++) {
+		if (size > pools[i]->info.block_size) {
+			continue;
+		}
+		/* a full class falls back to the heap, a larger class would waste more */
+		if (k_mem_slab_alloc(pools[i], &ptr, K_NO_WAIT)) {
+			pool_stats_full(i);
+			return NULL;
+		}
+		pool_stats_alloc(i, size);
+		return ptr;
+	}
+	return NULL;
+}
+
+static bool pool_free(void *ptr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pools); i++) {
+		const uint8_t *start = (const uint8_t *)pools[i]->buffer;
+		const size_t size = pools[i]->info.block_size * pools[i]->info.num_blocks;
+
+		if ((const uint8_t *)ptr >= start && (const uint8_t *)ptr < start + size) {
+			k_mem_slab_free(pools[i], ptr);
+			return true;
+		}
+	}
+	return false;
+}
+#endif /* CONFIG_SIDEWALK_HEAP_POOLS */
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 static void heap_alloc_stats(struct sys_heap *p_heap, size_t mem_to_alloc)
 {
@@ -105,13 +244,31 @@ void print_open_buffers(void)
 }
 #endif
 
-void *sid_hal_malloc(size_t size)
+static void *heap_alloc(size_t size)
 {
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	heap_alloc_stats(&sid_heap.heap, size);
 #endif
 
-	void *ptr = k_heap_alloc(&sid_heap, size, K_NO_WAIT);
+	void *ptr = k_heap_aligned_alloc(&sid_heap, MEM_ALIGN, size, K_NO_WAIT);
+#ifdef CONFIG_SIDEWALK_HEAP_POOL_STATS
+	heap_stats_alloc(ptr, size);
+#endif
+	return ptr;
+}
+
+void *sid_hal_malloc(size_t size)
+{
+	void *ptr = NULL;
+
+#ifdef CONFIG_SIDEWALK_HEAP_POOLS
+	if (size) {
+		ptr = pool_alloc(size);
+	}
+#endif
+	if (!ptr) {
+		ptr = heap_alloc(size);
+	}
 #if CONFIG_SIDEWALK_TRACE_HEAP
 	LOG_DBG("Alloc %d bytes at addr %p", size, ptr);
 	alloc_stat++;
@@ -131,5 +288,10 @@ void sid_hal_free(void *ptr)
 	free_stat++;
 	remove_buffer(ptr);
 #endif /* CONFIG_SIDEWALK_TRACE_HEAP */
+#ifdef CONFIG_SIDEWALK_HEAP_POOLS
+	if (pool_free(ptr)) {
+		return;
+	}
+#endif
 	k_heap_free(&sid_heap, ptr);
 }
@@ -11,10 +11,16 @@
 #include <sid_hal_reset_ifc.h>
 #include <zephyr/sys/reboot.h>
 #include <zephyr/kernel.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+#include <sid_storage_kv_ext.h>
+#endif
 
 sid_error_t sid_hal_reset(sid_hal_reset_type_t type)
 {
 	if (SID_HAL_RESET_NORMAL == type) {
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+		(void)sid_storage_kv_flush();
+#endif
 		sys_reboot(SYS_REBOOT_WARM);
 	} else {
 		return SID_ERROR_NOSUPPORT;
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_CRITICAL_REGION_EXT_H
+#define SID_CRITICAL_REGION_EXT_H
+
+#include <stdint.h>
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+struct sid_critical_region_site {
+	/* Return address of the outermost sid_pal_enter_critical_region() call */
+	uintptr_t site;
+	/* Number of critical sections entered from the site */
+	uint32_t count;
+	uint32_t max_hold_us;
+	uint32_t max_depth;
+};
+
+struct sid_critical_region_stats {
+	struct sid_critical_region_site sites[CONFIG_SIDEWALK_CRITICAL_REGION_STATS_SITES];
+	uint32_t sites_used;
+	/* Critical sections entered from sites that did not fit in the table */
+	uint32_t untracked;
+	uint32_t max_hold_us;
+	uint32_t max_depth;
+};
+
+/**
+ * @brief Get the critical region statistics.
+ *
+ * The call site addresses can be resolved with addr2line.
+ *
+ * @param stats - pointer to the statistics.
+ */
+void sid_critical_region_stats_get(struct sid_critical_region_stats *stats);
+
+/**
+ * @brief Reset the critical region statistics.
+ */
+void sid_critical_region_stats_reset(void);
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+
+#endif /* SID_CRITICAL_REGION_EXT_H */
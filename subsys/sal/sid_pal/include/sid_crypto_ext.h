@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_CRYPTO_EXT_H
+#define SID_CRYPTO_EXT_H
+
+#include <sid_pal_crypto_ifc.h>
+#include <psa/crypto.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Hash computed over data passed in parts. */
+struct sid_pal_crypto_hash_ctx {
+	psa_hash_operation_t op;
+};
+
+/* HMAC computed over data passed in parts. */
+struct sid_pal_crypto_hmac_ctx {
+	psa_mac_operation_t op;
+	psa_key_id_t key;
+};
+
+/**
+ * @brief Start a hash computed over data passed in parts.
+ *
+ * On any error of the start, update or finish, the operation is aborted.
+ *
+ * @param ctx - context of the operation.
+ * @param algo - hash algorithm.
+ *
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_crypto_hash_start(struct sid_pal_crypto_hash_ctx *ctx,
+				      sid_pal_hash_algo_t algo);
+
+/**
+ * @brief Add data to a hash, the data can have any size.
+ *
+ * @param ctx - context of the operation.
+ * @param data - data to hash.
+ * @param data_size - size of the data.
+ *
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_crypto_hash_update(struct sid_pal_crypto_hash_ctx *ctx, const uint8_t *data,
+				       size_t data_size);
+
+/**
+ * @brief Get the digest of all data added and end the operation.
+ *
+ * @param ctx - context of the operation.
+ * @param digest - buffer for the digest.
+ * @param digest_size - size of the buffer, at least the size of the digest.
+ *
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_crypto_hash_finish(struct sid_pal_crypto_hash_ctx *ctx, uint8_t *digest,
+				       size_t digest_size);
+
+/**
+ * @brief End a hash without a digest, it can be called on an ended operation.
+ *
+ * @param ctx - context of the operation.
+ */
+void sid_pal_crypto_hash_abort(struct sid_pal_crypto_hash_ctx *ctx);
+
+/**
+ * @brief Start an HMAC computed over data passed in parts.
+ *
+ * The key is imported until the operation ends. On any error of the start, update or finish,
+ * the operation is aborted.
+ *
+ * @param ctx - context of the operation.
+ * @param algo - hash algorithm of the HMAC.
+ * @param key - key material.
+ * @param key_size - size of the key in bytes.
+ *
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_crypto_hmac_start(struct sid_pal_crypto_hmac_ctx *ctx,
+				      sid_pal_hash_algo_t algo, const uint8_t *key,
+				      size_t key_size);
+
+/**
+ * @brief Add data to an HMAC, the data can have any size.
+ *
+ * @param ctx - context of the operation.
+ * @param data - data to authenticate.
+ * @param data_size - size of the data.
+ *
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_crypto_hmac_update(struct sid_pal_crypto_hmac_ctx *ctx, const uint8_t *data,
+				       size_t data_size);
+
+/**
+ * @brief Get the HMAC of all data added and end the operation.
+ *
+ * @param ctx - context of the operation.
+ * @param digest - buffer for the HMAC.
+ * @param digest_size - size of the buffer, at least the size of the HMAC.
+ *
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_crypto_hmac_finish(struct sid_pal_crypto_hmac_ctx *ctx, uint8_t *digest,
+				       size_t digest_size);
+
+/**
+ * @brief End an HMAC without a result, it can be called on an ended operation.
+ *
+ * @param ctx - context of the operation.
+ */
+void sid_pal_crypto_hmac_abort(struct sid_pal_crypto_hmac_ctx *ctx);
+
+#endif /* SID_CRYPTO_EXT_H */
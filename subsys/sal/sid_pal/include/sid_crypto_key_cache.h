@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_CRYPTO_KEY_CACHE_H
+#define SID_CRYPTO_KEY_CACHE_H
+
+#include <psa/crypto.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct sid_crypto_key_cache_stats {
+	/* keys found in the cache */
+	uint32_t hits;
+	/* keys imported */
+	uint32_t misses;
+	/* cached keys destroyed to make room */
+	uint32_t evictions;
+	/* keys imported without caching, all entries were in use */
+	uint32_t bypasses;
+};
+
+/**
+ * @brief Get a volatile key with the key material and attributes, import it if not cached.
+ *
+ * Keys are looked up by the SHA-256 digest of the key material together with the type, size,
+ * algorithm and usage, the key material itself is not kept. The least recently used key
+ * not in use is destroyed when the cache is full. Every key got must be put back with
+ * sid_crypto_key_cache_put().
+ *
+ * @param key - key material.
+ * @param key_length - length of the key material in bytes.
+ * @param attributes - attributes of the key to import.
+ * @param key_handle - handle of the key.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+psa_status_t sid_crypto_key_cache_get(const uint8_t *key, size_t key_length,
+				      const psa_key_attributes_t *attributes,
+				      psa_key_id_t *key_handle);
+
+/**
+ * @brief Put back a key got with sid_crypto_key_cache_get().
+ *
+ * A key that was not cached is destroyed.
+ *
+ * @param key_handle - handle of the key.
+ */
+void sid_crypto_key_cache_put(psa_key_id_t key_handle);
+
+/**
+ * @brief Destroy all cached keys and wipe their digests.
+ *
+ * A key still in use is not found any more and is destroyed when it is put back.
+ */
+void sid_crypto_key_cache_clear(void);
+
+/**
+ * @brief Get the counters of the key cache.
+ *
+ * @param stats - pointer to the statistics.
+ */
+void sid_crypto_key_cache_stats_get(struct sid_crypto_key_cache_stats *stats);
+
+/**
+ * @brief Reset the counters of the key cache.
+ */
+void sid_crypto_key_cache_stats_reset(void);
+
+#endif /* SID_CRYPTO_KEY_CACHE_H */
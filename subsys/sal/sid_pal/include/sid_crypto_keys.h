@@ -108,6 +108,18 @@ int sid_crypto_keys_buffer_get(psa_key_id_t *id, uint8_t *buffer, size_t size);
  */
 int sid_crypto_keys_delete(psa_key_id_t id);
 
+/**
+ * @brief Destroy a batch of keys.
+ * 
+ * @note This operation is irreversible. Every key is destroyed even if another one fails,
+ *  and keys that do not exist are skipped.
+ * 
+ * @param ids [in] psa key ids to be permanently removed.
+ * @param count [in] number of key ids.
+ * @return 0 on success, or the first -errno on failure.
+ */
+int sid_crypto_keys_delete_batch(const psa_key_id_t *ids, size_t count);
+
 /**
  * @brief Deinit sidewalk key storage.
  * 
@@ -9,6 +9,7 @@
 
 #include <zephyr/devicetree.h>
 #include <zephyr/drivers/gpio.h>
+#include <zephyr/sys_clock.h>
 #include <sid_pal_gpio_ifc.h>
 
 #define GPIO_UNUSED_PIN 128
@@ -116,4 +117,17 @@ int sid_gpio_utils_irq_configure(uint32_t gpio_number, gpio_flags_t irq_flags);
  */
 int sid_gpio_utils_irq_set(uint32_t gpio_number, bool set);
 
+/**
+ * @brief Wait until the GPIO input reads the given raw level
+ *
+ * Sleeps until an edge interrupt of the pin, so it must be called from a thread
+ * with interrupts unlocked. The pin must not have a Sidewalk interrupt configured.
+ *
+ * @param gpio_number - GPIO pin number
+ * @param level - raw level to wait for
+ * @param timeout - maximum time to wait
+ * @return int - ERRNO status code, -EAGAIN on timeout
+ */
+int sid_gpio_utils_wait_level(uint32_t gpio_number, uint8_t level, k_timeout_t timeout);
+
 #endif /* SID_GPIO_UTILS_H */
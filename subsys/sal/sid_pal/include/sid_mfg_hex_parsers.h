@@ -41,3 +41,16 @@ int parse_mfg_raw_tlv(tlv_ctx *tlv);
  * @return int 0 on success, -ERRNO on error
  */
 int parse_mfg_const_offsets(tlv_ctx *tlv);
+
+/**
+ * @brief Store the parsed manufacturing image in place of the raw partition.
+ * Only blocks of CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE bytes that differ from the storage
+ * are erased and written. The start offset must be aligned to the block size.
+ *
+ * @param tlv [IN] configuration for tlv, the image starts at its start offset
+ * @param image [IN] parsed image
+ * @param size size of the image
+ * @param blocks_written [OUT] number of blocks erased and written
+ * @return int 0 on success, -EINVAL if the start offset is not aligned, -ERRNO on error
+ */
+int mfg_store_image(tlv_ctx *tlv, const uint8_t *image, uint32_t size, uint32_t *blocks_written);
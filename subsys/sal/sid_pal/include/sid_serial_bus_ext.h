@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_SERIAL_BUS_EXT_H
+#define SID_SERIAL_BUS_EXT_H
+
+#include <sid_pal_serial_bus_ifc.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Maximum number of buffers in one vectored transfer */
+#define SID_PAL_SERIAL_BUS_BUFS_MAX 4
+
+struct sid_pal_serial_bus_buf {
+	/* Data to send, NULL to send the bus idle pattern */
+	const uint8_t *tx;
+	/* Buffer for the received data, NULL to discard it */
+	uint8_t *rx;
+	size_t len;
+};
+
+/**
+ * @brief Transfer a list of buffers in one bus transaction.
+ *
+ * The buffers are sent back to back with the chip select held, so a command header and its
+ * payload do not have to be copied to one buffer first. The tx and rx of a buffer may point
+ * to the same memory. The buffers are read by DMA, so they must be in RAM, see
+ * sid_pal_serial_bus_buf_in_ram.
+ *
+ * @param iface - bus interface returned by sid_pal_serial_bus_nordic_spi_create.
+ * @param client - bus client.
+ * @param bufs - buffers to transfer.
+ * @param count - number of buffers, up to SID_PAL_SERIAL_BUS_BUFS_MAX.
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_serial_bus_xfer_v(const struct sid_pal_serial_bus_iface *iface,
+				      const struct sid_pal_serial_bus_client *client,
+				      const struct sid_pal_serial_bus_buf *bufs, size_t count);
+
+/**
+ * @brief Wait for the end of an asynchronous transfer.
+ *
+ * Returns right away if no transfer is pending. Synchronous transfers wait for the pending
+ * transfer by themselves.
+ *
+ * @param iface - bus interface returned by sid_pal_serial_bus_nordic_spi_create.
+ * @return result of the pending transfer, SID_ERROR_NONE if there was none.
+ */
+sid_error_t sid_pal_serial_bus_flush(const struct sid_pal_serial_bus_iface *iface);
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+/**
+ * @brief Callback called in interrupt context at the end of an asynchronous transfer.
+ *
+ * @param result - SID_ERROR_NONE in case of success.
+ * @param user_data - pointer passed to sid_pal_serial_bus_xfer_v_async.
+ */
+typedef void (*sid_pal_serial_bus_done_t)(sid_error_t result, void *user_data);
+
+/**
+ * @brief Start a vectored transfer and return before it ends.
+ *
+ * Works like sid_pal_serial_bus_xfer_v. The bufs array is copied, but the memory it points to
+ * must stay valid until the transfer ends. One transfer is in flight at a time, a second call
+ * waits for the pending one first.
+ *
+ * @param iface - bus interface returned by sid_pal_serial_bus_nordic_spi_create.
+ * @param client - bus client.
+ * @param bufs - buffers to transfer.
+ * @param count - number of buffers, up to SID_PAL_SERIAL_BUS_BUFS_MAX.
+ * @param done - callback called at the end of the transfer, may be NULL.
+ * @param user_data - pointer passed to the callback.
+ * @return SID_ERROR_NONE if the transfer was started.
+ */
+sid_error_t sid_pal_serial_bus_xfer_v_async(const struct sid_pal_serial_bus_iface *iface,
+					    const struct sid_pal_serial_bus_client *client,
+					    const struct sid_pal_serial_bus_buf *bufs, size_t count,
+					    sid_pal_serial_bus_done_t done, void *user_data);
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+struct sid_pal_serial_bus_stats {
+	uint32_t transfers;
+	/* Transfers started with sid_pal_serial_bus_xfer_v_async */
+	uint32_t async_transfers;
+	uint64_t bytes;
+	/* Time the calling threads waited for transfers, in synchronous calls and flushes */
+	uint64_t blocked_us;
+	uint32_t max_blocked_us;
+};
+
+/**
+ * @brief Get the SPI bus statistics.
+ *
+ * @param stats - pointer to the statistics.
+ */
+void sid_pal_serial_bus_stats_get(struct sid_pal_serial_bus_stats *stats);
+
+/**
+ * @brief Reset the SPI bus statistics.
+ */
+void sid_pal_serial_bus_stats_reset(void);
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+/**
+ * @brief Check if a buffer can be transferred without a copy.
+ *
+ * @param buf - buffer to check.
+ * @param len - length of the buffer.
+ * @return true if the buffer is in one of the SRAM regions of the devicetree,
+ *         false if it is in flash and must be copied first.
+ */
+bool sid_pal_serial_bus_buf_in_ram(const void *buf, size_t len);
+
+#endif /* SID_SERIAL_BUS_EXT_H */
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_STORAGE_BACKEND_H
+#define SID_STORAGE_BACKEND_H
+
+#include <stdint.h>
+
+/*
+ * Records of the Sidewalk key-value storage in the non-volatile memory.
+ *
+ * The backend is selected with the SIDEWALK_STORAGE_KV_BACKEND choice. Secure keys and the
+ * write-back cache are handled by sid_storage.c, the backend only keeps the records.
+ */
+
+/**
+ * @brief Prepare the backend for use.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int sid_storage_backend_init(void);
+
+/**
+ * @brief Read a record.
+ *
+ * @param group - group of the record.
+ * @param key - key of the record.
+ * @param data - buffer for the value.
+ * @param len - size of the buffer, longer values are truncated.
+ * @return number of bytes read, -ENOENT if there is no such record, negative errno otherwise.
+ */
+int sid_storage_backend_read(uint16_t group, uint16_t key, void *data, uint32_t len);
+
+/**
+ * @brief Get the length of a record.
+ *
+ * @param group - group of the record.
+ * @param key - key of the record.
+ * @param len - length of the value.
+ * @return 0 on success, -ENOENT if there is no such record, negative errno otherwise.
+ */
+int sid_storage_backend_len(uint16_t group, uint16_t key, uint32_t *len);
+
+/**
+ * @brief Write a record.
+ *
+ * The record may be kept by the backend until sid_storage_backend_commit().
+ *
+ * @param group - group of the record.
+ * @param key - key of the record.
+ * @param data - value of the record.
+ * @param len - length of the value, not 0.
+ * @return 0 on success, negative errno otherwise.
+ */
+int sid_storage_backend_write(uint16_t group, uint16_t key, const void *data, uint32_t len);
+
+/**
+ * @brief Delete a record.
+ *
+ * @param group - group of the record.
+ * @param key - key of the record.
+ * @return 0 on success or if there is no such record, negative errno otherwise.
+ */
+int sid_storage_backend_delete(uint16_t group, uint16_t key);
+
+/**
+ * @brief Make the records written and deleted so far persistent.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int sid_storage_backend_commit(void);
+
+/**
+ * @brief Delete all records of a group.
+ *
+ * The records are not found after the call, but the backend may erase them later,
+ * in the background or before the next change of the storage.
+ *
+ * @param group - group to delete.
+ * @return 0 on success, negative errno otherwise.
+ */
+int sid_storage_backend_group_delete(uint16_t group);
+
+#endif /* SID_STORAGE_BACKEND_H */
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_STORAGE_KV_EXT_H
+#define SID_STORAGE_KV_EXT_H
+
+#include <sid_error.h>
+#include <stdint.h>
+
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+struct sid_storage_kv_stats {
+	/* records set by the stack */
+	uint32_t sets;
+	/* sets that never reach the flash, the value did not change or was set again */
+	uint32_t writes_avoided;
+	/* records written to the flash */
+	uint32_t flash_writes;
+	/* records deleted from the flash */
+	uint32_t flash_deletes;
+	/* settings commits */
+	uint32_t commits;
+	/* flushes of the cache */
+	uint32_t flushes;
+	/* reads served from the cache */
+	uint32_t read_hits;
+	/* reads from the flash */
+	uint32_t read_misses;
+};
+
+/**
+ * @brief Write the records waiting in the cache to the flash.
+ *
+ * The cache is flushed on its own when enough records wait or after a delay. Call it before
+ * the device resets or powers off.
+ *
+ * @retval SID_ERROR_NONE in case of success
+ * @retval SID_ERROR_STORAGE_WRITE_FAIL when some records could not be written, they stay in the cache
+ */
+sid_error_t sid_storage_kv_flush(void);
+
+/**
+ * @brief Get the counters of the key-value storage.
+ *
+ * @param stats - pointer to the statistics.
+ */
+void sid_storage_kv_stats_get(struct sid_storage_kv_stats *stats);
+
+/**
+ * @brief Reset the counters of the key-value storage.
+ */
+void sid_storage_kv_stats_reset(void);
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
+
+#endif /* SID_STORAGE_KV_EXT_H */
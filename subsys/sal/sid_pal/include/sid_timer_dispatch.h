@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_TIMER_DISPATCH_H
+#define SID_TIMER_DISPATCH_H
+
+/*
+ * Deferred dispatch of expired Sidewalk timers, enabled with SIDEWALK_TIMER_DEFERRED.
+ *
+ * The timer expiry interrupt moves the expired timers to a ready ring and wakes the worker
+ * thread selected with the SIDEWALK_TIMER_DEFERRED_WORKER choice, which runs the callbacks.
+ */
+
+/**
+ * @brief Run the callbacks of the expired timers.
+ *
+ * Must be called from the worker thread only.
+ */
+void sid_timer_dispatch_ready(void);
+
+/**
+ * @brief Wake the software interrupt thread to dispatch expired timers.
+ *
+ * Can be called from interrupt context.
+ */
+void sid_pal_swi_timer_notify(void);
+
+#endif /* SID_TIMER_DISPATCH_H */
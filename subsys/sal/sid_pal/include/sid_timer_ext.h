@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_TIMER_EXT_H
+#define SID_TIMER_EXT_H
+
+#include <sid_pal_timer_ifc.h>
+#include <stdint.h>
+
+/**
+ * @brief Arm a timer that may expire up to slack after the requested time.
+ *
+ * Works like sid_pal_timer_arm, with the slack given explicitly instead of the priority class.
+ * The timer expires together with another timer scheduled within the slack. If the device
+ * wakes up for another timer between the requested time and the expiry, the timer expires then.
+ * The slack is limited to 4095 ms.
+ *
+ * @param timer - timer object to arm.
+ * @param when - time of the first event.
+ * @param period - period of the events, NULL or SID_TIME_INFINITY for a one-shot timer.
+ * @param slack - accepted delay of the events, NULL for none.
+ * @return SID_ERROR_NONE in case of success.
+ */
+sid_error_t sid_pal_timer_arm_with_slack(sid_pal_timer_t *timer, const struct sid_timespec *when,
+					 const struct sid_timespec *period,
+					 const struct sid_timespec *slack);
+
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+struct sid_timer_stats {
+	/* Number of timer insertions, including periodic re-arms */
+	uint32_t armed;
+	/* Insertions moved to the expiry of an already scheduled timer */
+	uint32_t coalesced;
+	/* Insertions moved to a wake window boundary */
+	uint32_t aligned;
+	/* Hardware timer reprograms */
+	uint32_t reprograms;
+	/* Coalesced insertions that would otherwise reprogram the hardware timer */
+	uint32_t reprograms_avoided;
+	/* Timer expiry handler runs */
+	uint32_t wakeups;
+	/* Expired timers, expired - wakeups is the number of wakeups shared by timers */
+	uint32_t expired;
+	/* Timers expired before the alarm, together with another timer */
+	uint32_t expired_early;
+};
+
+/**
+ * @brief Get the timer statistics.
+ *
+ * @param stats - pointer to the statistics.
+ */
+void sid_timer_stats_get(struct sid_timer_stats *stats);
+
+/**
+ * @brief Reset the timer statistics.
+ */
+void sid_timer_stats_reset(void);
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+
+#ifdef CONFIG_SIDEWALK_TIMER_LATENCY_STATS
+/* Bucket 0 counts delays below 1 us, bucket n counts delays in [2^(n-1), 2^n) us */
+#define SID_TIMER_LATENCY_BUCKETS 16
+
+struct sid_timer_latency_stats {
+	/* Delay from the alarm to the expiry handler */
+	uint32_t fire_delay[SID_TIMER_LATENCY_BUCKETS];
+	/* Delay from the expiry handler to the callback, deferred dispatch only */
+	uint32_t dispatch_delay[SID_TIMER_LATENCY_BUCKETS];
+	uint32_t fire_delay_max_us;
+	uint32_t dispatch_delay_max_us;
+};
+
+/**
+ * @brief Get the timer latency histograms.
+ *
+ * @param stats - pointer to the histograms.
+ */
+void sid_timer_latency_stats_get(struct sid_timer_latency_stats *stats);
+
+/**
+ * @brief Reset the timer latency histograms.
+ */
+void sid_timer_latency_stats_reset(void);
+#endif /* CONFIG_SIDEWALK_TIMER_LATENCY_STATS */
+
+#endif /* SID_TIMER_EXT_H */
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_TIMER_QUEUE_H
+#define SID_TIMER_QUEUE_H
+
+#include <sid_pal_timer_ifc.h>
+#include <stdbool.h>
+
+/*
+ * Queue of armed Sidewalk timers ordered by alarm time.
+ *
+ * The backend is selected with the SIDEWALK_TIMER_QUEUE choice. None of the functions
+ * below are synchronized, the caller must hold the Sidewalk critical region.
+ */
+
+/**
+ * @brief Add the timer to the queue.
+ *
+ * @param timer - timer with valid alarm, must not be queued.
+ */
+void sid_timer_queue_insert(sid_pal_timer_t *timer);
+
+/**
+ * @brief Remove the timer from the queue.
+ *
+ * @param timer - timer to remove, no operation if it is not queued.
+ */
+void sid_timer_queue_remove(sid_pal_timer_t *timer);
+
+/**
+ * @brief Check if the timer is queued.
+ *
+ * @param timer - timer to check.
+ * @return true if the timer is queued.
+ */
+bool sid_timer_queue_contains(const sid_pal_timer_t *timer);
+
+/**
+ * @brief Get the timer with the earliest alarm.
+ *
+ * @return pointer to the timer, or NULL if the queue is empty.
+ */
+sid_pal_timer_t *sid_timer_queue_peek(void);
+
+/**
+ * @brief Get the first queued timer with alarm later than given time.
+ *
+ * @param alarm - reference time.
+ * @return pointer to the timer, or NULL if there is no such timer.
+ */
+sid_pal_timer_t *sid_timer_queue_find_later(const struct sid_timespec *alarm);
+
+#endif /* SID_TIMER_QUEUE_H */
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SID_UPTIME_EXT_H
+#define SID_UPTIME_EXT_H
+
+#include <sid_time_types.h>
+
+/**
+ * @brief Convert Sidewalk uptime to kernel uptime.
+ *
+ * Sidewalk uptime is corrected by the crystal offset set with sid_pal_uptime_set_xtal_ppm,
+ * so kernel timeouts for a Sidewalk uptime must be converted.
+ *
+ * @param uptime - Sidewalk uptime.
+ * @param kernel - earliest kernel uptime at which the Sidewalk uptime is reached.
+ */
+void sid_uptime_to_kernel(const struct sid_timespec *uptime, struct sid_timespec *kernel);
+
+#ifdef CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING
+/**
+ * @brief Learn the crystal offset from a time reference.
+ *
+ * Call on time synchronization events. The offset is measured between two calls at least
+ * CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING_MIN_INTERVAL seconds apart and applied to the uptime.
+ *
+ * @param reference - reference time at the moment of the call, for example network time.
+ */
+void sid_uptime_sync(const struct sid_timespec *reference);
+#endif /* CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING */
+
+#endif /* SID_UPTIME_EXT_H */
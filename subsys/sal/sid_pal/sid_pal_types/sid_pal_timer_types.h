@@ -16,10 +16,17 @@
 #define SID_PAL_TIMER_TYPES_H
 
 #include <zephyr/sys/dlist.h>
+#include <zephyr/sys/rb.h>
 #include <sid_time_types.h>
 
 typedef struct sid_pal_timer_impl_t sid_pal_timer_t;
 
+/* Slack and its use share one word with the queue sequence number */
+#define SID_PAL_TIMER_SLACK_BITS 12
+#define SID_PAL_TIMER_SLACK_MS_MAX ((1U << SID_PAL_TIMER_SLACK_BITS) - 1)
+#define SID_PAL_TIMER_SEQ_BITS 8
+#define SID_PAL_TIMER_SEQ_MAX ((1U << SID_PAL_TIMER_SEQ_BITS) - 1)
+
 /**
  * @brief Timer callback type
  *
@@ -36,10 +43,17 @@ typedef void (*sid_pal_timer_cb_t)(void *arg, sid_pal_timer_t *originator);
 struct sid_pal_timer_impl_t {
 	struct sid_timespec alarm;
 	struct sid_timespec period;
-	sys_dnode_t node;
+	/* Queue linkage, the member in use depends on the SIDEWALK_TIMER_QUEUE backend */
+	union {
+		sys_dnode_t node;
+		struct rbnode rb_node;
+	};
 	sid_pal_timer_cb_t callback;
 	void *callback_arg;
-	const struct sid_timespec *tolerance;
+	uint32_t slack_ms : SID_PAL_TIMER_SLACK_BITS;
+	uint32_t deferred_ms : SID_PAL_TIMER_SLACK_BITS;
+	/* Insertion order among queued timers with equal alarm and deferred_ms */
+	uint32_t seq : SID_PAL_TIMER_SEQ_BITS;
 };
 
 #endif
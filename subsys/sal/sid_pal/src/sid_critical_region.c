@@ -6,34 +6,225 @@
 
 /** @file sid_critical_region.c
  *  @brief Critical region interface implementation.
+ *
+ *  The region is owned by one CPU at a time and may be entered again by the owner.
+ *  The interrupt key is saved by the outermost enter only, so nested sections restore
+ *  nothing. A k_spinlock can not be taken twice on the same CPU, so the owner is tracked
+ *  here and other CPUs spin on it.
  */
 
 #include <sid_pal_critical_region_ifc.h>
+#include <sid_critical_region_ext.h>
 #include <assert.h>
+#include <string.h>
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 
-static atomic_t count = ATOMIC_INIT(0);
-static unsigned int key = 0;
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO
+#include <cmsis_core.h>
 
-void sid_pal_enter_critical_region()
+#define REGION_BASEPRI                                                                             \
+	Z_EXC_PRIO(_IRQ_PRIO_OFFSET + CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO_LEVEL)
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO */
+
+static struct {
+	unsigned int key;
+	unsigned int depth;
+#ifdef CONFIG_SMP
+	/* CPU id + 1 of the owner, 0 when free */
+	atomic_t owner;
+#endif /* CONFIG_SMP */
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO
+	/* Exception number of the owner, to catch calls from unmasked interrupts */
+	uint32_t owner_ipsr;
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO */
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+	uintptr_t site;
+	uint32_t enter_cycles;
+	unsigned int max_depth;
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+} region;
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+static struct {
+	struct {
+		uintptr_t site;
+		uint32_t count;
+		uint32_t max_hold_cycles;
+		uint32_t max_depth;
+	} sites[CONFIG_SIDEWALK_CRITICAL_REGION_STATS_SITES];
+	uint32_t sites_used;
+	uint32_t untracked;
+} region_stats;
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+
+static inline unsigned int region_mask(void)
+{
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO
+	const unsigned int key = __get_BASEPRI();
+
+	/* Only raises the masking level, so it works under irq_lock() too */
+	__set_BASEPRI_MAX(REGION_BASEPRI);
+	__ISB();
+
+	return key;
+#else
+	return arch_irq_lock();
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO */
+}
+
+static inline void region_unmask(unsigned int key)
+{
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO
+	__set_BASEPRI(key);
+	__ISB();
+#else
+	arch_irq_unlock(key);
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO */
+}
+
+/* Called with interrupts masked, returns true if the region was already owned by the caller */
+static inline bool region_acquire(void)
 {
-	const unsigned int prev_val = atomic_add(&count, 1);
+#ifdef CONFIG_SMP
+	const atomic_val_t self = (atomic_val_t)arch_curr_cpu()->id + 1;
 
-	if (prev_val == 0) {
-		key = irq_lock();
+	if (atomic_get(&region.owner) == self) {
+		return true;
+	}
+	while (!atomic_cas(&region.owner, 0, self)) {
+		arch_spin_relax();
 	}
 
-	assert(prev_val <= CONFIG_SIDEWALK_CRITICAL_REGION_RE_ENTRY_MAX);
+	return false;
+#else
+	/* The owner can not be preempted by code entering the region */
+	return region.depth > 0;
+#endif /* CONFIG_SMP */
 }
 
-void sid_pal_exit_critical_region()
+static inline void region_release(void)
+{
+#ifdef CONFIG_SMP
+	atomic_set(&region.owner, 0);
+#endif /* CONFIG_SMP */
+}
+
+static unsigned int region_lock(void)
+{
+	const unsigned int key = region_mask();
+
+	if (region_acquire()) {
+		/* Nested, the key only repeats the masked state */
+		region.depth++;
+		assert(region.depth <= CONFIG_SIDEWALK_CRITICAL_REGION_RE_ENTRY_MAX + 1);
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO
+		assert(region.owner_ipsr == __get_IPSR());
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO */
+		return region.depth;
+	}
+
+	region.key = key;
+	region.depth = 1;
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO
+	region.owner_ipsr = __get_IPSR();
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO */
+
+	return region.depth;
+}
+
+static void region_unlock(void)
 {
-	const unsigned int prev_val = atomic_sub(&count, 1);
+	assert(region.depth > 0);
 
-	assert(prev_val > 0);
+	if (region.depth == 1) {
+		const unsigned int key = region.key;
 
-	if (prev_val == 1) {
-		irq_unlock(key);
+		region.depth = 0;
+		region_release();
+		region_unmask(key);
+	} else {
+		region.depth--;
 	}
 }
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+/* Called in the outermost section, before it is left */
+static void region_stats_record(void)
+{
+	const uint32_t hold = k_cycle_get_32() - region.enter_cycles;
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(region_stats.sites); i++) {
+		if (i == region_stats.sites_used) {
+			region_stats.sites[i].site = region.site;
+			region_stats.sites_used++;
+		} else if (region_stats.sites[i].site != region.site) {
+			continue;
+		}
+		region_stats.sites[i].count++;
+		region_stats.sites[i].max_hold_cycles =
+			MAX(region_stats.sites[i].max_hold_cycles, hold);
+		region_stats.sites[i].max_depth =
+			MAX(region_stats.sites[i].max_depth, region.max_depth);
+		return;
+	}
+
+	region_stats.untracked++;
+}
+
+void sid_critical_region_stats_get(struct sid_critical_region_stats *stats)
+{
+	region_lock();
+	*stats = (struct sid_critical_region_stats){
+		.sites_used = region_stats.sites_used,
+		.untracked = region_stats.untracked,
+	};
+	for (uint32_t i = 0; i < region_stats.sites_used; i++) {
+		stats->sites[i] = (struct sid_critical_region_site){
+			.site = region_stats.sites[i].site,
+			.count = region_stats.sites[i].count,
+			.max_hold_us = k_cyc_to_us_ceil32(region_stats.sites[i].max_hold_cycles),
+			.max_depth = region_stats.sites[i].max_depth,
+		};
+		stats->max_hold_us = MAX(stats->max_hold_us, stats->sites[i].max_hold_us);
+		stats->max_depth = MAX(stats->max_depth, stats->sites[i].max_depth);
+	}
+	region_unlock();
+}
+
+void sid_critical_region_stats_reset(void)
+{
+	region_lock();
+	memset(&region_stats, 0, sizeof(region_stats));
+	region_unlock();
+}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+
+void sid_pal_enter_critical_region()
+{
+	const unsigned int depth = region_lock();
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+	if (depth == 1) {
+		region.site = (uintptr_t)__builtin_return_address(0);
+		region.max_depth = 1;
+		region.enter_cycles = k_cycle_get_32();
+	} else {
+		region.max_depth = MAX(region.max_depth, depth);
+	}
+#else
+	ARG_UNUSED(depth);
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+}
+
+void sid_pal_exit_critical_region()
+{
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_STATS
+	if (region.depth == 1) {
+		region_stats_record();
+	}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+
+	region_unlock();
+}
@@ -12,6 +12,10 @@
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 #include <sid_crypto_keys.h>
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+#include <sid_crypto_key_cache.h>
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+#include <sid_crypto_ext.h>
 
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
@@ -33,9 +37,6 @@ LOG_MODULE_REGISTER(sid_crypto, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
 #define SECP256R1_KEY_LEN_BITS (256)
 #define ED25519_KEY_LEN_BITS (255)
 
-/* Data chunk used in cryptographic algorithm. */
-#define ALGO_DATA_CHUNK (32)
-
 /* Max. EC key buffer length in bytes. */
 #define EC_MAX_KEY_LENGTH (65)
 #define EC_MAX_PUBLIC_KEY_LENGTH (EC_MAX_KEY_LENGTH)
@@ -56,6 +57,11 @@ LOG_MODULE_REGISTER(sid_crypto, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
 		 ((SID_PAL_CRYPTO_DECRYPT == _mode) ? PSA_KEY_USAGE_DECRYPT :                      \
 						      PSA_KEY_USAGE_SIGN_MESSAGE))
 
+/* AEAD message processed with a single PSA call. */
+#define AEAD_IS_ONE_SHOT(_params)                                                                  \
+	((NULL != (_params)->iv) &&                                                                \
+	 ((_params)->in_size <= CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX))
+
 /* Sid ECDSA mode to PSA key usage policy. */
 #define ECDSA_MODE_TO_USAGE(_mode)                                                                 \
 	((SID_PAL_CRYPTO_VERIFY == _mode) ? PSA_KEY_USAGE_VERIFY_MESSAGE :                         \
@@ -75,7 +81,8 @@ static const uint8_t secpxxx_key_prefix[SECPxxx_KEY_PREFIX_LEN] = { 0x04 };
 static sid_error_t get_error(psa_status_t psa_erc, const char *func_name);
 static psa_status_t prepare_key(const uint8_t *key, size_t key_length, size_t key_bits,
 				psa_key_usage_t usage_flags, psa_algorithm_t alg,
-				psa_key_type_t type, psa_key_id_t *key_handle);
+				psa_key_type_t type, bool cached, psa_key_id_t *key_handle);
+static void release_key(psa_key_id_t key_handle, bool cached);
 static psa_status_t aes_execute(psa_cipher_operation_t *operation, sid_pal_aes_params_t *params);
 static psa_status_t aes_encrypt(psa_key_id_t key_handle, sid_pal_aes_params_t *params);
 static psa_status_t aes_decrypt(psa_key_id_t key_handle, sid_pal_aes_params_t *params);
@@ -139,13 +146,14 @@ static sid_error_t get_error(psa_status_t psa_erc, const char *func_name)
  * @param usage_flags - define which opeartions are permitted with te key.
  * @param alg - key permitted-algorithm policy.
  * @param type - key type.
+ * @param cached - take the key from the key cache, release it with release_key().
  * @param key_handle - handle to key (null when key cannot be set).
  *
  * @return PSA_SUCCESS when success, otherwise error code.
  */
 static psa_status_t prepare_key(const uint8_t *key, size_t key_length, size_t key_bits,
 				psa_key_usage_t usage_flags, psa_algorithm_t alg,
-				psa_key_type_t type, psa_key_id_t *key_handle)
+				psa_key_type_t type, bool cached, psa_key_id_t *key_handle)
 {
 	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
 	psa_status_t status;
@@ -167,6 +175,12 @@ static psa_status_t prepare_key(const uint8_t *key, size_t key_length, size_t ke
 	psa_set_key_type(&attributes, type);
 	psa_set_key_bits(&attributes, key_bits);
 
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+	if (cached) {
+		return sid_crypto_key_cache_get(key, key_length, &attributes, key_handle);
+	}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+
 	status = psa_import_key(&attributes, key, key_length, key_handle);
 	if (PSA_SUCCESS == status) {
 		psa_reset_key_attributes(&attributes);
@@ -175,6 +189,30 @@ static psa_status_t prepare_key(const uint8_t *key, size_t key_length, size_t ke
 	return status;
 }
 
+/**
+ * @brief The function releases a key prepared with prepare_key.
+ *
+ * @param key_handle - handle to key.
+ * @param cached - the key was prepared from the key cache.
+ */
+static void release_key(psa_key_id_t key_handle, bool cached)
+{
+#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
+	if (SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
+		return;
+	}
+#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+	if (cached) {
+		sid_crypto_key_cache_put(key_handle);
+		return;
+	}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+	if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
+		LOG_WRN("Destroy key failed!");
+	}
+}
+
 /**
  * @brief Perform the AES algorithm.
  * NOTE: The algorithm must be set before calling this function.
@@ -321,6 +359,82 @@ static psa_status_t aead_execute(psa_aead_operation_t *op, sid_pal_aead_params_t
 	return status;
 }
 
+#if CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX > 0
+/**
+ * @brief The function encrypts a whole message with a single PSA call.
+ * NOTE: PSA returns the ciphertext followed by the tag, they are joined in a local buffer
+ * unless the MAC follows the output buffer.
+ *
+ * @param key_handle - key to use for encryption operation.
+ * @param params - AEAD parameters.
+ * @param alg - AEAD algorithm to compute.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t aead_encrypt_one_shot(psa_key_id_t key_handle, sid_pal_aead_params_t *params,
+					  psa_algorithm_t alg)
+{
+	uint8_t joined[CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX + PSA_AEAD_TAG_MAX_SIZE];
+	const bool contiguous = (params->out + params->in_size == params->mac);
+	uint8_t *out = contiguous ? params->out : joined;
+	size_t out_len = 0;
+	psa_status_t status;
+
+	if (params->out_size < params->in_size || params->mac_size > PSA_AEAD_TAG_MAX_SIZE) {
+		return PSA_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	status = psa_aead_encrypt(key_handle, alg, params->iv, params->iv_size, params->aad,
+				  params->aad_size, params->in, params->in_size, out,
+				  params->in_size + params->mac_size, &out_len);
+	LOG_DBG("psa_aead_encrypt %s (out_len=%d)",
+		(PSA_SUCCESS == status) ? "success." : "failed!", out_len);
+	if (PSA_SUCCESS == status && !contiguous) {
+		memcpy(params->out, joined, params->in_size);
+		memcpy(params->mac, joined + params->in_size, params->mac_size);
+	}
+
+	return status;
+}
+
+/**
+ * @brief The function decrypts a whole message with a single PSA call.
+ * NOTE: PSA takes the ciphertext followed by the tag, they are joined in a local buffer
+ * unless the MAC follows the input buffer.
+ *
+ * @param key_handle - key to use for decryption operation.
+ * @param params - AEAD parameters.
+ * @param alg - AEAD algorithm to compute.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t aead_decrypt_one_shot(psa_key_id_t key_handle, sid_pal_aead_params_t *params,
+					  psa_algorithm_t alg)
+{
+	uint8_t joined[CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX + PSA_AEAD_TAG_MAX_SIZE];
+	const uint8_t *in = params->in;
+	size_t out_len = 0;
+	psa_status_t status;
+
+	if (params->mac_size > PSA_AEAD_TAG_MAX_SIZE) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+	if (params->in + params->in_size != params->mac) {
+		memcpy(joined, params->in, params->in_size);
+		memcpy(joined + params->in_size, params->mac, params->mac_size);
+		in = joined;
+	}
+
+	status = psa_aead_decrypt(key_handle, alg, params->iv, params->iv_size, params->aad,
+				  params->aad_size, in, params->in_size + params->mac_size,
+				  params->out, params->out_size, &out_len);
+	LOG_DBG("psa_aead_decrypt %s (out_len=%d)",
+		(PSA_SUCCESS == status) ? "success." : "failed!", out_len);
+
+	return status;
+}
+#endif /* CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX > 0 */
+
 /**
  * @brief The function processes authenticated encryption operation.
  *
@@ -333,6 +447,12 @@ static psa_status_t aead_execute(psa_aead_operation_t *op, sid_pal_aead_params_t
 static psa_status_t aead_encrypt(psa_key_id_t key_handle, sid_pal_aead_params_t *params,
 				 psa_algorithm_t alg)
 {
+#if CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX > 0
+	if (AEAD_IS_ONE_SHOT(params)) {
+		return aead_encrypt_one_shot(key_handle, params, alg);
+	}
+#endif /* CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX > 0 */
+
 	psa_aead_operation_t op = PSA_AEAD_OPERATION_INIT;
 	psa_status_t status = psa_aead_encrypt_setup(&op, key_handle, alg);
 
@@ -359,6 +479,12 @@ static psa_status_t aead_encrypt(psa_key_id_t key_handle, sid_pal_aead_params_t
 static psa_status_t aead_decrypt(psa_key_id_t key_handle, sid_pal_aead_params_t *params,
 				 psa_algorithm_t alg)
 {
+#if CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX > 0
+	if (AEAD_IS_ONE_SHOT(params)) {
+		return aead_decrypt_one_shot(key_handle, params, alg);
+	}
+#endif /* CONFIG_SIDEWALK_CRYPTO_AEAD_ONE_SHOT_SIZE_MAX > 0 */
+
 	psa_aead_operation_t op = PSA_AEAD_OPERATION_INIT;
 	psa_status_t status = psa_aead_decrypt_setup(&op, key_handle, alg);
 
@@ -389,6 +515,9 @@ sid_error_t sid_pal_crypto_init(void)
 
 sid_error_t sid_pal_crypto_deinit(void)
 {
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+	sid_crypto_key_cache_clear();
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 	int err = sid_crypto_keys_deinit();
 	if (err) {
@@ -454,7 +583,6 @@ sid_error_t sid_pal_crypto_hash(sid_pal_hash_params_t *params)
 sid_error_t sid_pal_crypto_hmac(sid_pal_hmac_params_t *params)
 {
 	psa_status_t status;
-	psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT;
 	psa_algorithm_t alg_sha;
 	psa_key_id_t key_handle;
 
@@ -484,55 +612,186 @@ sid_error_t sid_pal_crypto_hmac(sid_pal_hmac_params_t *params)
 	// NOTE: key_size is in bytes.
 	status = prepare_key(params->key, params->key_size, BYTE_TO_BITS(params->key_size),
 			     PSA_KEY_USAGE_SIGN_HASH, PSA_ALG_HMAC(alg_sha), PSA_KEY_TYPE_HMAC,
-			     &key_handle);
+			     true, &key_handle);
 
 	if (PSA_SUCCESS == status) {
-		size_t hmac_length;
+		size_t hmac_length = 0;
 		LOG_DBG("Key load success.");
-		status = psa_mac_sign_setup(&operation, key_handle, PSA_ALG_HMAC(alg_sha));
+		status = psa_mac_compute(key_handle, PSA_ALG_HMAC(alg_sha), params->data,
+					 params->data_size, params->digest, params->digest_size,
+					 &hmac_length);
+		LOG_DBG("psa_mac_compute %s [hmac length=%d]",
+			(PSA_SUCCESS == status) ? "success." : "failed!", hmac_length);
 
-		if (PSA_SUCCESS == status) {
-			size_t offset = 0;
-			size_t data_chunk = ALGO_DATA_CHUNK;
-			size_t s_left = params->data_size;
+		release_key(key_handle, true);
+	}
 
-			LOG_DBG("psa_mac_sign_setup success.");
-			do {
-				data_chunk = MIN(s_left, data_chunk);
+	return get_error(status, __func__);
+}
 
-				status = psa_mac_update(&operation, &params->data[offset],
-							data_chunk);
+/**
+ * @brief The function maps the Sidewalk hash algorithm to the PSA one.
+ *
+ * @param algo - Sidewalk hash algorithm.
+ *
+ * @return PSA hash algorithm, PSA_ALG_NONE when not supported.
+ */
+static psa_algorithm_t hash_alg_get(sid_pal_hash_algo_t algo)
+{
+	switch (algo) {
+	case SID_PAL_HASH_SHA256:
+		return PSA_ALG_SHA_256;
+	case SID_PAL_HASH_SHA512:
+		return PSA_ALG_SHA_512;
+	default:
+		return PSA_ALG_NONE;
+	}
+}
 
-				offset += data_chunk;
-				s_left -= data_chunk;
-			} while ((PSA_SUCCESS == status) && (0 != s_left));
+sid_error_t sid_pal_crypto_hash_start(struct sid_pal_crypto_hash_ctx *ctx,
+				      sid_pal_hash_algo_t algo)
+{
+	psa_algorithm_t alg_sha = hash_alg_get(algo);
 
-			if (PSA_SUCCESS == status) {
-				LOG_DBG("psa_mac_update success.");
-				status = psa_mac_sign_finish(&operation, params->digest,
-							     params->digest_size, &hmac_length);
-				LOG_DBG("psa_mac_sign_finish %s [hmac length=%d]",
-					(PSA_SUCCESS == status) ? "success." : "failed!",
-					hmac_length);
-			}
-		}
+	if (!is_initialized) {
+		return SID_ERROR_UNINITIALIZED;
+	}
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-				LOG_WRN("Destroy key failed!");
-			}
-		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-			LOG_WRN("Destroy key failed!");
-		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+	if (!ctx) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	ctx->op = psa_hash_operation_init();
+	if (PSA_ALG_NONE == alg_sha) {
+		return SID_ERROR_NOSUPPORT;
+	}
+
+	return get_error(psa_hash_setup(&ctx->op, alg_sha), __func__);
+}
+
+sid_error_t sid_pal_crypto_hash_update(struct sid_pal_crypto_hash_ctx *ctx, const uint8_t *data,
+				       size_t data_size)
+{
+	if (!ctx || (!data && data_size)) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	psa_status_t status = psa_hash_update(&ctx->op, data, data_size);
+	if (PSA_SUCCESS != status) {
+		sid_pal_crypto_hash_abort(ctx);
+	}
+
+	return get_error(status, __func__);
+}
+
+sid_error_t sid_pal_crypto_hash_finish(struct sid_pal_crypto_hash_ctx *ctx, uint8_t *digest,
+				       size_t digest_size)
+{
+	size_t hash_length;
+
+	if (!ctx || !digest) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	psa_status_t status = psa_hash_finish(&ctx->op, digest, digest_size, &hash_length);
+	if (PSA_SUCCESS != status) {
+		sid_pal_crypto_hash_abort(ctx);
+	}
+
+	return get_error(status, __func__);
+}
+
+void sid_pal_crypto_hash_abort(struct sid_pal_crypto_hash_ctx *ctx)
+{
+	if (ctx && PSA_SUCCESS != psa_hash_abort(&ctx->op)) {
+		LOG_WRN("Abort failed!");
+	}
+}
+
+sid_error_t sid_pal_crypto_hmac_start(struct sid_pal_crypto_hmac_ctx *ctx,
+				      sid_pal_hash_algo_t algo, const uint8_t *key,
+				      size_t key_size)
+{
+	psa_algorithm_t alg_sha = hash_alg_get(algo);
+	psa_status_t status;
+
+	if (!is_initialized) {
+		return SID_ERROR_UNINITIALIZED;
+	}
+
+	if (!ctx || !key) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	ctx->op = psa_mac_operation_init();
+	ctx->key = PSA_KEY_ID_NULL;
+	if (!key_size) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+	if (PSA_ALG_NONE == alg_sha) {
+		return SID_ERROR_NOSUPPORT;
+	}
+
+	// NOTE: key_size is in bytes, the policy matches sid_pal_crypto_hmac to share the key.
+	status = prepare_key(key, key_size, BYTE_TO_BITS(key_size), PSA_KEY_USAGE_SIGN_HASH,
+			     PSA_ALG_HMAC(alg_sha), PSA_KEY_TYPE_HMAC, true, &ctx->key);
+	if (PSA_SUCCESS != status) {
+		ctx->key = PSA_KEY_ID_NULL;
+		return get_error(status, __func__);
+	}
+
+	status = psa_mac_sign_setup(&ctx->op, ctx->key, PSA_ALG_HMAC(alg_sha));
+	if (PSA_SUCCESS != status) {
+		sid_pal_crypto_hmac_abort(ctx);
 	}
 
 	return get_error(status, __func__);
 }
 
+sid_error_t sid_pal_crypto_hmac_update(struct sid_pal_crypto_hmac_ctx *ctx, const uint8_t *data,
+				       size_t data_size)
+{
+	if (!ctx || (!data && data_size)) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	psa_status_t status = psa_mac_update(&ctx->op, data, data_size);
+	if (PSA_SUCCESS != status) {
+		sid_pal_crypto_hmac_abort(ctx);
+	}
+
+	return get_error(status, __func__);
+}
+
+sid_error_t sid_pal_crypto_hmac_finish(struct sid_pal_crypto_hmac_ctx *ctx, uint8_t *digest,
+				       size_t digest_size)
+{
+	size_t hmac_length;
+
+	if (!ctx || !digest) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	psa_status_t status = psa_mac_sign_finish(&ctx->op, digest, digest_size, &hmac_length);
+	sid_pal_crypto_hmac_abort(ctx);
+
+	return get_error(status, __func__);
+}
+
+void sid_pal_crypto_hmac_abort(struct sid_pal_crypto_hmac_ctx *ctx)
+{
+	if (!ctx) {
+		return;
+	}
+	if (PSA_SUCCESS != psa_mac_abort(&ctx->op)) {
+		LOG_WRN("Abort failed!");
+	}
+	if (PSA_KEY_ID_NULL != ctx->key) {
+		release_key(ctx->key, true);
+		ctx->key = PSA_KEY_ID_NULL;
+	}
+}
+
 sid_error_t sid_pal_crypto_aes_crypt(sid_pal_aes_params_t *params)
 {
 	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
@@ -576,7 +835,8 @@ sid_error_t sid_pal_crypto_aes_crypt(sid_pal_aes_params_t *params)
 
 	// NOTE: key_size is in bits.
 	status = prepare_key(params->key, BITS_TO_BYTE(params->key_size), params->key_size,
-			     AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES, &key_handle);
+			     AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES, true,
+			     &key_handle);
 
 	if (PSA_SUCCESS == status) {
 		LOG_DBG("Key import success");
@@ -599,20 +859,11 @@ sid_error_t sid_pal_crypto_aes_crypt(sid_pal_aes_params_t *params)
 				(PSA_SUCCESS == status) ? "success." : "failed!");
 		} break;
 		default:
-			return SID_ERROR_INVALID_ARGS;
+			status = PSA_ERROR_INVALID_ARGUMENT;
+			break;
 		}
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-				LOG_WRN("Destroy key failed!");
-			}
-		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-			LOG_WRN("Destroy key failed!");
-		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+		release_key(key_handle, true);
 	}
 
 	return get_error(status, __func__);
@@ -663,7 +914,8 @@ sid_error_t sid_pal_crypto_aead_crypt(sid_pal_aead_params_t *params)
 
 	// NOTE: key_size is in bits.
 	status = prepare_key(params->key, BITS_TO_BYTE(params->key_size), params->key_size,
-			     AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES, &key_handle);
+			     AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES, true,
+			     &key_handle);
 
 	if (PSA_SUCCESS == status) {
 		LOG_DBG("Key import success.");
@@ -680,20 +932,11 @@ sid_error_t sid_pal_crypto_aead_crypt(sid_pal_aead_params_t *params)
 				(PSA_SUCCESS == status) ? "success." : "failed!");
 			break;
 		default:
-			return SID_ERROR_INVALID_ARGS;
+			status = PSA_ERROR_INVALID_ARGUMENT;
+			break;
 		}
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-				LOG_WRN("Destroy key failed!");
-			}
-		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-			LOG_WRN("Destroy key failed!");
-		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+		release_key(key_handle, true);
 	}
 
 	return get_error(status, __func__);
@@ -754,7 +997,7 @@ sid_error_t sid_pal_crypto_ecc_dsa(sid_pal_dsa_params_t *params)
 
 	// NOTE: key_size is in bytes.
 	status = prepare_key(key, key_size, key_len, ECDSA_MODE_TO_USAGE(params->mode), alg,
-			     ECC_FAMILY_TYPE(params->mode, type), &key_handle);
+			     ECC_FAMILY_TYPE(params->mode, type), false, &key_handle);
 
 	if (PSA_SUCCESS == status) {
 		LOG_DBG("Key import success. handle %04x", key_handle);
@@ -835,7 +1078,8 @@ sid_error_t sid_pal_crypto_ecc_ecdh(sid_pal_ecdh_params_t *params)
 
 	// NOTE: params->prk_size and params->puk_size are in bytes.
 	status = prepare_key(params->prk, params->prk_size, key_len, PSA_KEY_USAGE_DERIVE,
-			     PSA_ALG_ECDH, PSA_KEY_TYPE_ECC_KEY_PAIR(type), &priv_key_handle);
+			     PSA_ALG_ECDH, PSA_KEY_TYPE_ECC_KEY_PAIR(type), false,
+			     &priv_key_handle);
 
 	if (PSA_SUCCESS == status) {
 		size_t out_len;
@@ -849,6 +1093,12 @@ sid_error_t sid_pal_crypto_ecc_ecdh(sid_pal_ecdh_params_t *params)
 					       params->shared_secret, params->shared_secret_sz,
 					       &out_len);
 		LOG_DBG("ecdh key agreement %s", (PSA_SUCCESS == status) ? "success." : "failed!");
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+		if (PSA_SUCCESS == status) {
+			/* New session keys follow, the cached ones are not used again */
+			sid_crypto_key_cache_clear();
+		}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
 
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(priv_key_handle)) {
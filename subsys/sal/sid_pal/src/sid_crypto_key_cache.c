@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_crypto_key_cache.h>
+
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(sid_crypto_key_cache, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
+
+#define KEY_DIGEST_SIZE PSA_HASH_LENGTH(PSA_ALG_SHA_256)
+
+struct key_entry {
+	uint8_t digest[KEY_DIGEST_SIZE];
+	psa_key_type_t type;
+	size_t bits;
+	psa_algorithm_t alg;
+	psa_key_usage_t usage;
+	psa_key_id_t handle;
+	/* operations using the key, it is not evicted until they are done */
+	uint16_t users;
+	/* cleared while in use, not found any more and destroyed on the last put */
+	bool evicted;
+	/* last use, the entry with the lowest value is evicted first */
+	uint32_t used_at;
+};
+
+static struct key_entry entries[CONFIG_SIDEWALK_CRYPTO_KEY_CACHE_ENTRIES];
+static uint32_t use_counter;
+static struct sid_crypto_key_cache_stats stats;
+static K_MUTEX_DEFINE(cache_lock);
+
+static void secure_zero(void *buf, size_t len)
+{
+	volatile uint8_t *p = buf;
+
+	while (len--) {
+		*p++ = 0;
+	}
+}
+
+static void entry_destroy(struct key_entry *entry)
+{
+	if (PSA_SUCCESS != psa_destroy_key(entry->handle)) {
+		LOG_WRN("Destroy key failed!");
+	}
+	secure_zero(entry, sizeof(*entry));
+	entry->handle = PSA_KEY_ID_NULL;
+}
+
+static struct key_entry *entry_find(const uint8_t *digest,
+				    const psa_key_attributes_t *attributes)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		struct key_entry *entry = &entries[i];
+
+		if (entry->handle != PSA_KEY_ID_NULL && !entry->evicted &&
+		    entry->type == psa_get_key_type(attributes) &&
+		    entry->bits == psa_get_key_bits(attributes) &&
+		    entry->alg == psa_get_key_algorithm(attributes) &&
+		    entry->usage == psa_get_key_usage_flags(attributes) &&
+		    !memcmp(entry->digest, digest, sizeof(entry->digest))) {
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+static struct key_entry *entry_free(void)
+{
+	struct key_entry *lru = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		struct key_entry *entry = &entries[i];
+
+		if (entry->handle == PSA_KEY_ID_NULL) {
+			return entry;
+		}
+		if (!entry->users && (!lru || (int32_t)(entry->used_at - lru->used_at) < 0)) {
+			lru = entry;
+		}
+	}
+	if (lru) {
+		entry_destroy(lru);
+		stats.evictions++;
+	}
+	return lru;
+}
+
+psa_status_t sid_crypto_key_cache_get(const uint8_t *key, size_t key_length,
+				      const psa_key_attributes_t *attributes,
+				      psa_key_id_t *key_handle)
+{
+	uint8_t digest[KEY_DIGEST_SIZE];
+	size_t digest_length;
+	psa_status_t status;
+
+	status = psa_hash_compute(PSA_ALG_SHA_256, key, key_length, digest, sizeof(digest),
+				  &digest_length);
+	if (PSA_SUCCESS != status) {
+		return status;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	struct key_entry *entry = entry_find(digest, attributes);
+	if (entry) {
+		entry->users++;
+		entry->used_at = ++use_counter;
+		*key_handle = entry->handle;
+		stats.hits++;
+		goto out;
+	}
+
+	status = psa_import_key(attributes, key, key_length, key_handle);
+	if (PSA_SUCCESS != status) {
+		goto out;
+	}
+	stats.misses++;
+
+	entry = entry_free();
+	if (!entry) {
+		/* every key is in use, the caller destroys this one on put */
+		stats.bypasses++;
+		goto out;
+	}
+	memcpy(entry->digest, digest, sizeof(entry->digest));
+	entry->type = psa_get_key_type(attributes);
+	entry->bits = psa_get_key_bits(attributes);
+	entry->alg = psa_get_key_algorithm(attributes);
+	entry->usage = psa_get_key_usage_flags(attributes);
+	entry->handle = *key_handle;
+	entry->users = 1;
+	entry->used_at = ++use_counter;
+out:
+	k_mutex_unlock(&cache_lock);
+	secure_zero(digest, sizeof(digest));
+	return status;
+}
+
+void sid_crypto_key_cache_put(psa_key_id_t key_handle)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		struct key_entry *entry = &entries[i];
+
+		if (entry->handle == key_handle && entry->users) {
+			entry->users--;
+			if (!entry->users && entry->evicted) {
+				entry_destroy(entry);
+			}
+			k_mutex_unlock(&cache_lock);
+			return;
+		}
+	}
+	k_mutex_unlock(&cache_lock);
+
+	if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
+		LOG_WRN("Destroy key failed!");
+	}
+}
+
+void sid_crypto_key_cache_clear(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		struct key_entry *entry = &entries[i];
+
+		if (entry->handle == PSA_KEY_ID_NULL) {
+			continue;
+		}
+		if (entry->users) {
+			/* the handle is still used, the last put destroys the key */
+			secure_zero(entry->digest, sizeof(entry->digest));
+			entry->evicted = true;
+			continue;
+		}
+		entry_destroy(entry);
+	}
+	k_mutex_unlock(&cache_lock);
+}
+
+void sid_crypto_key_cache_stats_get(struct sid_crypto_key_cache_stats *out)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	*out = stats;
+	k_mutex_unlock(&cache_lock);
+}
+
+void sid_crypto_key_cache_stats_reset(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	memset(&stats, 0, sizeof(stats));
+	k_mutex_unlock(&cache_lock);
+}
@@ -258,6 +258,32 @@ int sid_crypto_keys_delete(psa_key_id_t id)
 	return ESUCCESS;
 }
 
+int sid_crypto_keys_delete_batch(const psa_key_id_t *ids, size_t count)
+{
+	int result = ESUCCESS;
+
+	if (!ids) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(ids[i])) {
+			result = result ? result : -ENOENT;
+			continue;
+		}
+
+		psa_status_t status = psa_destroy_key(ids[i]);
+		if (status == PSA_ERROR_INVALID_HANDLE) {
+			LOG_DBG("no key to destroy %d", ids[i]);
+		} else if (status != PSA_SUCCESS) {
+			LOG_ERR("psa_destroy_key failed! (err %d id %d)", status, ids[i]);
+			result = result ? result : -EFAULT;
+		}
+	}
+
+	return result;
+}
+
 int sid_crypto_keys_deinit(void)
 {
 	/* Nothing to do, left for stable api for future features */
@@ -34,6 +34,10 @@ static struct ctx {
 	uint32_t next_free_slot;
 } ctx;
 
+/* Single waiter, the radio HAL waits on one pin at a time */
+static struct gpio_callback level_callback;
+static K_SEM_DEFINE(level_sem, 0, 1);
+
 K_THREAD_STACK_DEFINE(sidewalk_gpio_workq_stack, CONFIG_SIDEWALK_GPIO_IRQ_STACK_SIZE);
 struct k_work_q sidewalk_gpio_workq;
 
@@ -256,3 +260,48 @@ int sid_gpio_utils_irq_set(uint32_t gpio_number, bool set)
 
 	return erc;
 }
+
+static void sid_gpio_level_callback(const struct device *gpio, struct gpio_callback *cb,
+				    uint32_t pins)
+{
+	k_sem_give(&level_sem);
+}
+
+int sid_gpio_utils_wait_level(uint32_t gpio_number, uint8_t level, k_timeout_t timeout)
+{
+	CHECK_IF_GPIO_IS_REGISTERED(gpio_number)
+
+	const gpio_port_pin_t *port_pin = &ctx.supported_pins[gpio_number].gpio;
+	const k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	if (ctx.supported_pins[gpio_number].configuration_cache & GPIO_INT_ENABLE) {
+		return -EBUSY;
+	}
+
+	k_sem_reset(&level_sem);
+	gpio_init_callback(&level_callback, sid_gpio_level_callback, BIT(port_pin->pin));
+	int erc = gpio_add_callback(port_pin->port, &level_callback);
+	if (erc) {
+		return erc;
+	}
+
+	erc = gpio_pin_interrupt_configure(port_pin->port, port_pin->pin,
+					   level ? GPIO_INT_EDGE_RISING : GPIO_INT_EDGE_FALLING);
+	while (!erc) {
+		/* The edge may come before the interrupt is enabled, so read the level after */
+		int value = gpio_pin_get_raw(port_pin->port, port_pin->pin);
+
+		if (value < 0) {
+			erc = value;
+		} else if (value == level) {
+			break;
+		} else if (k_sem_take(&level_sem, sys_timepoint_timeout(end))) {
+			erc = -EAGAIN;
+		}
+	}
+
+	gpio_pin_interrupt_configure(port_pin->port, port_pin->pin, GPIO_INT_DISABLE);
+	gpio_remove_callback(port_pin->port, &level_callback);
+
+	return erc;
+}
@@ -72,6 +72,8 @@ int parse_mfg_const_offsets(tlv_ctx *tlv)
 		return -EINVAL;
 	}
 
+	const int64_t parse_start = k_uptime_get();
+
 	uint32_t size = tlv->end_offset - tlv->start_offset;
 
 	uint8_t *ram_tlv_data = sid_hal_malloc(size);
@@ -98,6 +100,13 @@ int parse_mfg_const_offsets(tlv_ctx *tlv)
 		return -EIO;
 	}
 
+	struct tlv_writer writer;
+	ret = tlv_writer_init(&writer, &ram_tlv);
+	if (ret != 0) {
+		sid_hal_free(ram_tlv_data);
+		return -EIO;
+	}
+
 	uint8_t payload_buffer[CONFIG_SIDEWALK_MFG_PARSER_MAX_ELEMENT_SIZE] = { 0 };
 
 	for (int i = 0; i < ARRAY_SIZE(sid_pal_mfg_store_app_value_to_offset_table); i++) {
@@ -142,7 +151,7 @@ int parse_mfg_const_offsets(tlv_ctx *tlv)
 			continue;
 		}
 #endif
-		ret = tlv_write(&ram_tlv, element.value, payload_buffer, element.size);
+		ret = tlv_writer_append(&writer, element.value, payload_buffer, element.size);
 		if (ret != 0) {
 			LOG_ERR("Failed to write data");
 			sid_hal_free(ram_tlv_data);
@@ -156,26 +165,21 @@ int parse_mfg_const_offsets(tlv_ctx *tlv)
 		.keys_in_psa = 1,
 #endif
 	};
-	ret = tlv_write(&ram_tlv, MFG_FLAGS_TYPE_ID, (uint8_t *)&flags, sizeof(flags));
+	ret = tlv_writer_append(&writer, MFG_FLAGS_TYPE_ID, (uint8_t *)&flags, sizeof(flags));
 	if (ret != 0) {
 		LOG_ERR("Failed to write data");
 		sid_hal_free(ram_tlv_data);
 		return -EIO;
 	}
 
-	ret = tlv->storage_impl.erase(tlv->storage_impl.ctx, tlv->start_offset, size);
+	uint32_t blocks_written = 0;
+	ret = mfg_store_image(tlv, ram_tlv_data, size, &blocks_written);
+	sid_hal_free(ram_tlv_data);
 	if (ret != 0) {
-		LOG_ERR("Failed to erase flash storage");
-		sid_hal_free(ram_tlv_data);
-		return -EIO;
+		return ret;
 	}
 
-	ret = tlv->storage_impl.write(tlv->storage_impl.ctx, tlv->start_offset, ram_tlv_data, size);
-	if (ret != 0) {
-		LOG_ERR("Failed to write parsed tlv data to flash");
-		sid_hal_free(ram_tlv_data);
-		return -EIO;
-	}
-	sid_hal_free(ram_tlv_data);
+	LOG_INF("Parsed mfg v7 in %lld ms, %u of %u blocks written", k_uptime_get() - parse_start,
+		blocks_written, DIV_ROUND_UP(size, CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE));
 	return 0;
 }
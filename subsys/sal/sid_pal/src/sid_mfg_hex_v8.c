@@ -5,6 +5,7 @@
  */
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
 #include <sid_mfg_hex_parsers.h>
 #include <sid_hal_memory_ifc.h>
 #include <stdint.h>
@@ -18,15 +19,78 @@
 #endif
 
 #define MFG_STORE_TLV_TAG_EMPTY 0xFFFF
+#define MFG_COMPARE_CHUNK 64
 
 LOG_MODULE_REGISTER(sid_mfg_parser_v8, CONFIG_SIDEWALK_LOG_LEVEL);
 
+static int mfg_block_changed(tlv_ctx *tlv, uint32_t offset, const uint8_t *image, uint32_t size,
+			     bool *changed)
+{
+	uint8_t stored[MFG_COMPARE_CHUNK];
+
+	*changed = false;
+	for (uint32_t done = 0; done < size; done += sizeof(stored)) {
+		uint32_t chunk = MIN(sizeof(stored), size - done);
+		int ret = tlv->storage_impl.read(tlv->storage_impl.ctx, offset + done, stored,
+						 chunk);
+		if (ret != 0) {
+			return ret;
+		}
+		if (memcmp(stored, image + done, chunk) != 0) {
+			*changed = true;
+			return 0;
+		}
+	}
+	return 0;
+}
+
+int mfg_store_image(tlv_ctx *tlv, const uint8_t *image, uint32_t size, uint32_t *blocks_written)
+{
+	*blocks_written = 0;
+	/* a block not aligned to the erase block would erase the data next to it */
+	if (tlv->start_offset % CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE) {
+		LOG_ERR("Mfg storage at 0x%x not aligned to the %u B block", tlv->start_offset,
+			CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE);
+		return -EINVAL;
+	}
+	for (uint32_t done = 0; done < size; done += CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE) {
+		const uint32_t offset = tlv->start_offset + done;
+		const uint32_t block = MIN(CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE, size - done);
+		bool changed;
+
+		int ret = mfg_block_changed(tlv, offset, image + done, block, &changed);
+		if (ret != 0) {
+			LOG_ERR("Failed to read flash storage");
+			return -EIO;
+		}
+		if (!changed) {
+			continue;
+		}
+
+		ret = tlv->storage_impl.erase(tlv->storage_impl.ctx, offset, block);
+		if (ret != 0) {
+			LOG_ERR("Failed to erase flash storage");
+			return -EIO;
+		}
+		ret = tlv->storage_impl.write(tlv->storage_impl.ctx, offset,
+					      (uint8_t *)image + done, block);
+		if (ret != 0) {
+			LOG_ERR("Failed to write parsed tlv data to flash");
+			return -EIO;
+		}
+		(*blocks_written)++;
+	}
+	return 0;
+}
+
 int parse_mfg_raw_tlv(tlv_ctx *tlv)
 {
 	if (tlv->end_offset <= tlv->start_offset) {
 		return -EINVAL;
 	}
 
+	const int64_t parse_start = k_uptime_get();
+
 	uint32_t size = tlv->end_offset - tlv->start_offset;
 
 	uint8_t *ram_tlv_data = sid_hal_malloc(size);
@@ -55,29 +119,38 @@ int parse_mfg_raw_tlv(tlv_ctx *tlv)
 		return -EIO;
 	}
 
+	/* Append to the RAM image in one pass, without looking for the free space every time */
+	struct tlv_writer writer;
+	ret = tlv_writer_init(&writer, &ram_tlv);
+	if (ret != 0) {
+		sid_hal_free(ram_tlv_data);
+		return -EIO;
+	}
+
 	uint8_t payload_buffer[CONFIG_SIDEWALK_MFG_PARSER_MAX_ELEMENT_SIZE] = { 0 };
-	for (; offset < tlv->end_offset;) {
-		uint8_t key[2] = { 0 };
-		uint8_t size[2] = { 0 };
-		int ret = tlv->storage_impl.read(tlv->storage_impl.ctx, offset, key, sizeof(key));
+	while (offset + 2 <= tlv->end_offset) {
+		/* key and size */
+		uint8_t element[4] = { 0 };
+		const uint32_t element_size = MIN(sizeof(element), tlv->end_offset - offset);
+		int ret = tlv->storage_impl.read(tlv->storage_impl.ctx, offset, element,
+						 element_size);
 		if (ret != 0) {
 			LOG_ERR("Failed to read data");
 			sid_hal_free(ram_tlv_data);
 			return -EIO;
 		}
-		offset += 2;
-		uint16_t key_decoded = (key[0] << 8) + key[1];
+		uint16_t key_decoded = sys_get_be16(element);
 		if (key_decoded == MFG_STORE_TLV_TAG_EMPTY) {
 			break;
 		}
-		ret = tlv->storage_impl.read(tlv->storage_impl.ctx, offset, size, sizeof(size));
-		if (ret != 0) {
-			LOG_ERR("Failed to read data");
+		uint16_t size_decoded = sys_get_be16(&element[2]);
+		offset += sizeof(element);
+		if (element_size < sizeof(element) || size_decoded > sizeof(payload_buffer) ||
+		    offset + size_decoded > tlv->end_offset) {
+			LOG_ERR("Invalid mfg element %d size %d", key_decoded, size_decoded);
 			sid_hal_free(ram_tlv_data);
-			return -EIO;
+			return -EINVAL;
 		}
-		offset += 2;
-		uint16_t size_decoded = (size[0] << 8) | size[1];
 		ret = tlv->storage_impl.read(tlv->storage_impl.ctx, offset, payload_buffer,
 					     size_decoded);
 		if (ret != 0) {
@@ -112,7 +185,7 @@ int parse_mfg_raw_tlv(tlv_ctx *tlv)
 		}
 #endif
 
-		ret = tlv_write(&ram_tlv, key_decoded, payload_buffer, size_decoded);
+		ret = tlv_writer_append(&writer, key_decoded, payload_buffer, size_decoded);
 		if (ret != 0) {
 			LOG_ERR("Failed to write data");
 			sid_hal_free(ram_tlv_data);
@@ -126,26 +199,21 @@ int parse_mfg_raw_tlv(tlv_ctx *tlv)
 		.keys_in_psa = 1,
 #endif
 	};
-	ret = tlv_write(&ram_tlv, MFG_FLAGS_TYPE_ID, (uint8_t *)&flags, sizeof(flags));
+	ret = tlv_writer_append(&writer, MFG_FLAGS_TYPE_ID, (uint8_t *)&flags, sizeof(flags));
 	if (ret != 0) {
 		LOG_ERR("Failed to write data");
 		sid_hal_free(ram_tlv_data);
 		return -EIO;
 	}
 
-	ret = tlv->storage_impl.erase(tlv->storage_impl.ctx, tlv->start_offset, size);
+	uint32_t blocks_written = 0;
+	ret = mfg_store_image(tlv, ram_tlv_data, size, &blocks_written);
+	sid_hal_free(ram_tlv_data);
 	if (ret != 0) {
-		LOG_ERR("Failed to erase flash storage");
-		sid_hal_free(ram_tlv_data);
-		return -EIO;
+		return ret;
 	}
 
-	ret = tlv->storage_impl.write(tlv->storage_impl.ctx, tlv->start_offset, ram_tlv_data, size);
-	if (ret != 0) {
-		LOG_ERR("Failed to write parsed tlv data to flash");
-		sid_hal_free(ram_tlv_data);
-		return -EIO;
-	}
-	sid_hal_free(ram_tlv_data);
+	LOG_INF("Parsed mfg v8 in %lld ms, %u of %u blocks written", k_uptime_get() - parse_start,
+		blocks_written, DIV_ROUND_UP(size, CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE));
 	return 0;
 }
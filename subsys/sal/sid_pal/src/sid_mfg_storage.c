@@ -53,8 +53,33 @@ static int sid_mfg_storage_secure_read(uint16_t *p_value, uint8_t *buffer, uint1
 static const struct device *flash_dev;
 static uint32_t sid_mfg_version = INVALID_VERSION;
 tlv_ctx tlv_flash;
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+static struct tlv_index tlv_flash_index;
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+#ifdef CONFIG_SIDEWALK_TLV_READ_AHEAD
+static struct tlv_read_ahead tlv_flash_read_ahead;
+#endif /* CONFIG_SIDEWALK_TLV_READ_AHEAD */
+
+/* The parsed data is erased and written in blocks, each of whole flash pages */
+static int mfg_store_block_check(uint32_t offset)
+{
+#ifdef CONFIG_FLASH_PAGE_LAYOUT
+	struct flash_pages_info info;
+	int err = flash_get_page_info_by_offs(flash_dev, offset, &info);
+	if (err) {
+		return err;
+	}
+	if (CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE % info.size || offset % info.size ||
+	    offset % CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE) {
+		LOG_ERR("Mfg block of %u B at 0x%x does not match the %u B flash page",
+			CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE, offset, (uint32_t)info.size);
+		return -EINVAL;
+	}
+#endif /* CONFIG_FLASH_PAGE_LAYOUT */
+	return 0;
+}
 
-void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
+static void mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
 {
 	struct mfg_header header = { 0 };
 	bool need_to_parse = false;
@@ -73,6 +98,13 @@ void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
 			       .start_offset = mfg_store_region.addr_start,
 			       .end_offset = mfg_store_region.addr_end,
 			       .tlv_storage_start_marker_size = sizeof(struct mfg_header) };
+#ifdef CONFIG_SIDEWALK_TLV_READ_AHEAD
+	/* Read the small TLV headers with one flash read per window */
+	err = tlv_read_ahead_attach(&tlv_flash, &tlv_flash_read_ahead);
+	if (err) {
+		LOG_WRN("Failed to attach mfg read-ahead errno %d", err);
+	}
+#endif /* CONFIG_SIDEWALK_TLV_READ_AHEAD */
 
 #if CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 	err = sid_crypto_keys_init();
@@ -130,6 +162,11 @@ void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
 	if (need_to_parse) {
 		/* Save mfg data in desired version format */
 		LOG_INF("Need to parse mfg data");
+		err = mfg_store_block_check(tlv_flash.start_offset);
+		if (err) {
+			LOG_ERR("Failed to check mfg flash pages errno %d", err);
+			return;
+		}
 		switch (sid_mfg_version) {
 		case 8:
 			err = parse_mfg_raw_tlv(&tlv_flash);
@@ -165,6 +202,14 @@ void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
 	}
 #endif // CONFIG_FPROTECT AND NOT CONFIG_SIDEWALK_MFG_STORAGE_DIAGNOSTIC
 
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	/* The values are read many times at boot, find them without scanning the flash */
+	err = tlv_index_build(&tlv_flash, &tlv_flash_index);
+	if (err) {
+		LOG_WRN("Failed to index mfg data errno %d", err);
+	}
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+
 	uint8_t smsn_buffer[SID_SMSN_SIZE] = { 0 };
 	sid_pal_mfg_store_read(SID_PAL_MFG_STORE_SMSN, smsn_buffer, SID_SMSN_SIZE);
 	if (memcmp(smsn_buffer, (const uint8_t[SID_SMSN_SIZE]){ 0 }, SID_SMSN_SIZE) == 0) {
@@ -172,6 +217,25 @@ void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
 	} else {
 		LOG_HEXDUMP_DBG(smsn_buffer, SID_SMSN_SIZE, "Initialized with SMSN KEY: ");
 	}
+#ifdef CONFIG_SIDEWALK_TLV_READ_AHEAD
+	LOG_DBG("mfg init read %u times, %u flash reads, %u saved",
+		tlv_flash_read_ahead.stats.reads, tlv_flash_read_ahead.stats.backend_reads,
+		tlv_flash_read_ahead.stats.hits);
+#endif /* CONFIG_SIDEWALK_TLV_READ_AHEAD */
+}
+
+/* The window holds raw mfg bytes, the private keys among them */
+static void mfg_read_ahead_clear(void)
+{
+#ifdef CONFIG_SIDEWALK_TLV_READ_AHEAD
+	tlv_read_ahead_invalidate(&tlv_flash_read_ahead);
+#endif /* CONFIG_SIDEWALK_TLV_READ_AHEAD */
+}
+
+void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
+{
+	mfg_store_init(mfg_store_region);
+	mfg_read_ahead_clear();
 }
 
 void sid_pal_mfg_store_deinit(void)
@@ -192,7 +256,10 @@ int32_t sid_pal_mfg_store_write(uint16_t value, const uint8_t *buffer, uint16_t
 	}
 
 #if CONFIG_SIDEWALK_MFG_STORAGE_DIAGNOSTIC
-	return tlv_write(&tlv_flash, value, buffer, length);
+	/* the write looks up the entries through the window */
+	int ret = tlv_write(&tlv_flash, value, buffer, length);
+	mfg_read_ahead_clear();
+	return ret;
 #else
 	return (int32_t)SID_ERROR_NOSUPPORT;
 #endif
@@ -213,6 +280,7 @@ void sid_pal_mfg_store_read(uint16_t value, uint8_t *buffer, uint16_t length)
 		return;
 	}
 	int ret = tlv_read(&tlv_flash, value, buffer, length);
+	mfg_read_ahead_clear();
 	if (ret != 0) {
 		LOG_ERR("Failed to read tlv type %d with errno %d", value, ret);
 	}
@@ -223,6 +291,7 @@ uint16_t sid_pal_mfg_store_get_length_for_value(uint16_t value)
 	tlv_header header = {};
 
 	int ret = tlv_lookup(&tlv_flash, value, &header);
+	mfg_read_ahead_clear();
 	if (ret != 0) {
 		LOG_ERR("Failed to find value %d in MFG storage errno: %d", value, ret);
 		return 0;
@@ -234,6 +303,9 @@ int32_t sid_pal_mfg_store_erase(void)
 {
 #if CONFIG_SIDEWALK_MFG_STORAGE_DIAGNOSTIC
 	const size_t mfg_size = tlv_flash.end_offset - tlv_flash.start_offset;
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	tlv_index_invalidate(&tlv_flash);
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
 	return tlv_flash.storage_impl.erase(tlv_flash.storage_impl.ctx, tlv_flash.start_offset,
 					    mfg_size);
 #else
@@ -307,6 +379,7 @@ bool sid_pal_mfg_store_serial_num_get(uint8_t serial_num[SID_PAL_MFG_STORE_SERIA
 {
 	int ret = tlv_read(&tlv_flash, SID_PAL_MFG_STORE_SERIAL_NUM, serial_num,
 			   SID_PAL_MFG_STORE_SERIAL_NUM_SIZE);
+	mfg_read_ahead_clear();
 	return ret == 0;
 }
 
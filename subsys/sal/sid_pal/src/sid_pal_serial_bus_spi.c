@@ -5,11 +5,15 @@
  */
 
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/drivers/spi.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
 
 #include <sid_pal_serial_bus_ifc.h>
+#include <sid_serial_bus_ext.h>
 #include <sid_pal_gpio_ifc.h>
 #include <app_subGHz_config.h>
 
@@ -17,6 +21,7 @@
 LOG_MODULE_REGISTER(sid_spi_bus, CONFIG_SPI_BUS_LOG_LEVEL);
 
 #define LORA_DT_NODE DT_CHOSEN(zephyr_lora_transceiver)
+#define SRAM_DT_NODE DT_CHOSEN(zephyr_sram)
 
 #define SPI_OPTIONS                                                                                \
 	(uint16_t)(SPI_WORD_SET(8) | SPI_TRANSFER_MSB | SPI_OP_MODE_MASTER | SPI_FULL_DUPLEX)
@@ -33,6 +38,125 @@ static const struct sid_pal_serial_bus_iface zephyr_spi_bus_iface = {
 	.destroy = zephyr_spi_bus_destroy,
 };
 
+struct spi_bus_xfer {
+	struct spi_buf tx_buff[SID_PAL_SERIAL_BUS_BUFS_MAX];
+	struct spi_buf rx_buff[SID_PAL_SERIAL_BUS_BUFS_MAX];
+	struct spi_buf_set tx_set;
+	struct spi_buf_set rx_set;
+	const struct spi_buf_set *tx;
+	const struct spi_buf_set *rx;
+	size_t len;
+};
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+/* The spi_buf sets are read by the driver until the transfer ends */
+static struct {
+	struct spi_bus_xfer xfer;
+	sid_pal_serial_bus_done_t done;
+	void *user_data;
+	int result;
+	bool pending;
+} async_xfer;
+
+static K_SEM_DEFINE(async_xfer_done, 0, 1);
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+static struct sid_pal_serial_bus_stats bus_stats;
+
+static void spi_bus_stats_blocked(uint32_t start_cycles)
+{
+	const uint32_t blocked_us = k_cyc_to_us_ceil32(k_cycle_get_32() - start_cycles);
+
+	bus_stats.blocked_us += blocked_us;
+	bus_stats.max_blocked_us = MAX(bus_stats.max_blocked_us, blocked_us);
+}
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+/* A NULL spi_buf sends the over-run character or skips the received bytes */
+static sid_error_t spi_bus_xfer_init(struct spi_bus_xfer *xfer,
+				     const struct sid_pal_serial_bus_buf *bufs, size_t count)
+{
+	bool has_tx = false;
+	bool has_rx = false;
+
+	xfer->len = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (!bufs[i].len) {
+			return SID_ERROR_INVALID_ARGS;
+		}
+		xfer->tx_buff[i] =
+			(struct spi_buf){ .buf = (void *)bufs[i].tx, .len = bufs[i].len };
+		xfer->rx_buff[i] = (struct spi_buf){ .buf = bufs[i].rx, .len = bufs[i].len };
+		xfer->len += bufs[i].len;
+		has_tx |= bufs[i].tx != NULL;
+		has_rx |= bufs[i].rx != NULL;
+	}
+
+	xfer->tx_set = (struct spi_buf_set){ .buffers = xfer->tx_buff, .count = count };
+	xfer->rx_set = (struct spi_buf_set){ .buffers = xfer->rx_buff, .count = count };
+	xfer->tx = has_tx ? &xfer->tx_set : NULL;
+	xfer->rx = has_rx ? &xfer->rx_set : NULL;
+
+	return SID_ERROR_NONE;
+}
+
+static sid_error_t spi_bus_flush(void)
+{
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+	if (!async_xfer.pending) {
+		return SID_ERROR_NONE;
+	}
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+	const uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+	k_sem_take(&async_xfer_done, K_FOREVER);
+	async_xfer.pending = false;
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+	spi_bus_stats_blocked(start);
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+	return (async_xfer.result < 0) ? SID_ERROR_GENERIC : SID_ERROR_NONE;
+#else
+	return SID_ERROR_NONE;
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+}
+
+static sid_error_t spi_bus_transceive(const struct sid_pal_serial_bus_buf *bufs, size_t count)
+{
+	struct spi_bus_xfer xfer;
+	sid_error_t ret = spi_bus_xfer_init(&xfer, bufs, count);
+
+	if (ret != SID_ERROR_NONE) {
+		return ret;
+	}
+
+	/* Keeps the transfers in order, an error of the pending one was reported to its callback */
+	(void)spi_bus_flush();
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+	const uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+	int err = spi_transceive_dt(&bus_serial_spec, xfer.tx, xfer.rx);
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+	spi_bus_stats_blocked(start);
+	bus_stats.transfers++;
+	bus_stats.bytes += xfer.len;
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+	if (err < 0) {
+		LOG_ERR("spi xfer err %d", err);
+		return SID_ERROR_GENERIC;
+	}
+
+	return SID_ERROR_NONE;
+}
+
 static sid_error_t zephyr_spi_bus_xfer(const struct sid_pal_serial_bus_iface *iface,
 				       const struct sid_pal_serial_bus_client *client, uint8_t *tx,
 				       uint8_t *rx, size_t xfer_size)
@@ -40,39 +164,123 @@ static sid_error_t zephyr_spi_bus_xfer(const struct sid_pal_serial_bus_iface *if
 	LOG_DBG("%s(%p, %p, %p, %p, %d)", __func__, iface, client, (void *)tx, (void *)rx,
 		xfer_size);
 
-	sid_error_t ret = SID_ERROR_NONE;
-
 	if (iface != &zephyr_spi_bus_iface || (!tx && !rx) || !xfer_size || !client) {
 		return SID_ERROR_INVALID_ARGS;
 	}
 
-	struct spi_buf tx_buff[] = {
-		{
-			.buf = tx,
-			.len = xfer_size,
-		},
-	};
+	const struct sid_pal_serial_bus_buf buf = { .tx = tx, .rx = rx, .len = xfer_size };
+
+	return spi_bus_transceive(&buf, 1);
+}
+
+sid_error_t sid_pal_serial_bus_xfer_v(const struct sid_pal_serial_bus_iface *iface,
+				      const struct sid_pal_serial_bus_client *client,
+				      const struct sid_pal_serial_bus_buf *bufs, size_t count)
+{
+	LOG_DBG("%s(%p, %p, %p, %d)", __func__, iface, client, (void *)bufs, count);
+
+	if (iface != &zephyr_spi_bus_iface || !client || !bufs || !count ||
+	    count > SID_PAL_SERIAL_BUS_BUFS_MAX) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+
+	return spi_bus_transceive(bufs, count);
+}
+
+sid_error_t sid_pal_serial_bus_flush(const struct sid_pal_serial_bus_iface *iface)
+{
+	if (iface != &zephyr_spi_bus_iface) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+
+	return spi_bus_flush();
+}
 
-	struct spi_buf_set tx_set = { .buffers = tx_buff, .count = 1 };
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+static void spi_bus_async_done(const struct device *dev, int result, void *data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(data);
 
-	struct spi_buf rx_buff[] = {
-		{
-			.buf = rx,
-			.len = xfer_size,
-		},
-	};
+	async_xfer.result = result;
+	if (async_xfer.done) {
+		async_xfer.done((result < 0) ? SID_ERROR_GENERIC : SID_ERROR_NONE,
+				async_xfer.user_data);
+	}
+	k_sem_give(&async_xfer_done);
+}
+
+sid_error_t sid_pal_serial_bus_xfer_v_async(const struct sid_pal_serial_bus_iface *iface,
+					    const struct sid_pal_serial_bus_client *client,
+					    const struct sid_pal_serial_bus_buf *bufs, size_t count,
+					    sid_pal_serial_bus_done_t done, void *user_data)
+{
+	LOG_DBG("%s(%p, %p, %p, %d)", __func__, iface, client, (void *)bufs, count);
+
+	if (iface != &zephyr_spi_bus_iface || !client || !bufs || !count ||
+	    count > SID_PAL_SERIAL_BUS_BUFS_MAX) {
+		return SID_ERROR_INVALID_ARGS;
+	}
 
-	struct spi_buf_set rx_set = { .buffers = rx_buff, .count = 1 };
+	(void)spi_bus_flush();
 
-	int err = spi_transceive_dt(&bus_serial_spec, ((tx) ? &tx_set : NULL),
-				    ((rx) ? &rx_set : NULL));
+	sid_error_t ret = spi_bus_xfer_init(&async_xfer.xfer, bufs, count);
+
+	if (ret != SID_ERROR_NONE) {
+		return ret;
+	}
+
+	async_xfer.done = done;
+	async_xfer.user_data = user_data;
+	async_xfer.pending = true;
+
+	int err = spi_transceive_cb(bus_serial_spec.bus, &bus_serial_spec.config,
+				    async_xfer.xfer.tx, async_xfer.xfer.rx, spi_bus_async_done,
+				    NULL);
 
 	if (err < 0) {
-		LOG_ERR("spi xfer err %d", err);
-		ret = SID_ERROR_GENERIC;
+		LOG_ERR("spi async xfer err %d", err);
+		async_xfer.pending = false;
+		return SID_ERROR_GENERIC;
 	}
 
-	return ret;
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+	bus_stats.transfers++;
+	bus_stats.async_transfers++;
+	bus_stats.bytes += async_xfer.xfer.len;
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+	return SID_ERROR_NONE;
+}
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+void sid_pal_serial_bus_stats_get(struct sid_pal_serial_bus_stats *stats)
+{
+	*stats = bus_stats;
+}
+
+void sid_pal_serial_bus_stats_reset(void)
+{
+	memset(&bus_stats, 0, sizeof(bus_stats));
+}
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+
+static bool buf_in_region(uintptr_t addr, size_t len, uintptr_t start, size_t size)
+{
+	return addr >= start && addr - start <= size && len <= size - (addr - start);
+}
+
+#define SRAM_REGION_CONTAINS(node_id)                                                              \
+	buf_in_region(addr, len, DT_REG_ADDR(node_id), DT_REG_SIZE(node_id)) ||
+
+bool sid_pal_serial_bus_buf_in_ram(const void *buf, size_t len)
+{
+	const uintptr_t addr = (uintptr_t)buf;
+
+	/* The SPI DMA reaches every SRAM bank, not only the one the image runs from */
+	return DT_FOREACH_STATUS_OKAY(mmio_sram, SRAM_REGION_CONTAINS)
+		SRAM_REGION_CONTAINS(SRAM_DT_NODE) false;
 }
 
 static sid_error_t zephyr_spi_bus_destroy(const struct sid_pal_serial_bus_iface *iface)
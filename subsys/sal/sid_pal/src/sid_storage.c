@@ -10,9 +10,10 @@
 
 #include <sid_pal_storage_kv_ifc.h>
 #include <stdint.h>
-#include <stdio.h>
+#include <string.h>
+#include <errno.h>
 #include <zephyr/kernel.h>
-#include <zephyr/settings/settings.h>
+#include <sid_storage_backend.h>
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 #include <sid_crypto_keys.h>
 
@@ -24,23 +25,12 @@
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
 #include <zephyr/logging/log.h>
-#include <settings_utils.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+#include <sid_storage_kv_ext.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
 
 LOG_MODULE_REGISTER(sid_storage, CONFIG_SIDEWALK_LOG_LEVEL);
 
-#define STORAGE_SERIAL_SIZE (32)
-
-static void settings_serialize_group(char *serial, size_t serial_size, uint16_t group)
-{
-	snprintf(serial, serial_size, "sidewalk/storage/%04x", group);
-}
-
-static void settings_serialize_group_key(char *serial, size_t serial_size, uint16_t group,
-					 uint16_t key)
-{
-	snprintf(serial, serial_size, "sidewalk/storage/%04x/%04x", group, key);
-}
-
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 static psa_key_id_t storage2key_id(uint16_t group, uint16_t key)
 {
@@ -60,12 +50,10 @@ static psa_key_id_t storage2key_id(uint16_t group, uint16_t key)
 static void storage_key_save_secure(uint16_t group, uint16_t key)
 {
 	int err = 0;
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
 	uint8_t data[STORAGE_MASTER_KEY_SIZE];
 	psa_key_id_t key_id = storage2key_id(group, key);
 
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-	err = settings_utils_load_immediate_value(serial, (void *)data, STORAGE_MASTER_KEY_SIZE);
+	err = sid_storage_backend_read(group, key, (void *)data, STORAGE_MASTER_KEY_SIZE);
 	if (err == -ENOENT) {
 		LOG_DBG("not found key %04x", key);
 		return;
@@ -81,7 +69,10 @@ static void storage_key_save_secure(uint16_t group, uint16_t key)
 		return;
 	}
 
-	err = settings_delete(serial);
+	err = sid_storage_backend_delete(group, key);
+	if (err == 0) {
+		err = sid_storage_backend_commit();
+	}
 	if (err) {
 		LOG_ERR("delete key %04x err %d", key, err);
 		return;
@@ -103,17 +94,332 @@ static bool storage_key_delete_secure(sid_crypto_key_id_t id)
 
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-sid_error_t sid_pal_storage_kv_init()
+static sid_error_t storage_record_get(uint16_t group, uint16_t key, void *p_data, uint32_t len)
 {
-	int rc = settings_subsys_init();
-	if (rc != 0) {
-		LOG_ERR("settings init failed (err %d)", rc);
-		return SID_ERROR_GENERIC;
+	int rc = sid_storage_backend_read(group, key, p_data, len);
+	if (rc <= 0) {
+		return SID_ERROR_NOT_FOUND;
+	} else
+		return SID_ERROR_NONE;
+}
+
+static sid_error_t storage_record_get_len(uint16_t group, uint16_t key, uint32_t *p_len)
+{
+	*p_len = 0;
+	int rc = sid_storage_backend_len(group, key, p_len);
+	if (rc < 0 || *p_len == 0)
+		return SID_ERROR_NOT_FOUND;
+	else
+		return SID_ERROR_NONE;
+}
+
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+/*
+ * Write-back cache of records. The stack updates some records very often, the cache keeps the
+ * last value in RAM and writes it to the flash when enough records wait, after a delay or on
+ * sid_storage_kv_flush(), with one backend commit for all of them. Records read from the flash
+ * stay in the cache too, the least recently used clean record makes room for a new one.
+ */
+struct kv_cache_entry {
+	uint16_t group;
+	uint16_t key;
+	uint16_t len;
+	bool used;
+	/* false when the record is known to be deleted */
+	bool present;
+	/* the flash does not have the value yet */
+	bool dirty;
+	uint32_t last_use;
+	uint8_t data[SID_PAL_KV_STORE_MAX_LENGTH_BYTES];
+};
+
+static struct kv_cache_entry kv_cache[CONFIG_SIDEWALK_STORAGE_KV_CACHE_ENTRIES];
+static uint32_t kv_cache_clock;
+static struct sid_storage_kv_stats kv_stats;
+static K_MUTEX_DEFINE(kv_cache_lock);
+
+static void kv_cache_flush_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(kv_cache_flush_work, kv_cache_flush_work_handler);
+
+static struct kv_cache_entry *kv_cache_find(uint16_t group, uint16_t key)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(kv_cache); i++) {
+		if (kv_cache[i].used && kv_cache[i].group == group && kv_cache[i].key == key) {
+			kv_cache[i].last_use = ++kv_cache_clock;
+			return &kv_cache[i];
+		}
+	}
+	return NULL;
+}
+
+static sid_error_t kv_cache_flush_locked(void)
+{
+	sid_error_t result = SID_ERROR_NONE;
+	bool written = false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(kv_cache); i++) {
+		struct kv_cache_entry *entry = &kv_cache[i];
+		if (!entry->used || !entry->dirty) {
+			continue;
+		}
+
+		int rc;
+		if (entry->present) {
+			rc = sid_storage_backend_write(entry->group, entry->key, entry->data, entry->len);
+			kv_stats.flash_writes += (rc == 0);
+		} else {
+			rc = sid_storage_backend_delete(entry->group, entry->key);
+			kv_stats.flash_deletes += (rc == 0);
+		}
+		if (rc != 0) {
+			result = SID_ERROR_STORAGE_WRITE_FAIL;
+			continue;
+		}
+		entry->dirty = false;
+		written = true;
+	}
+
+	if (written) {
+		if (sid_storage_backend_commit() != 0) {
+			result = SID_ERROR_GENERIC;
+		}
+		kv_stats.commits++;
+	}
+	kv_stats.flushes++;
+	return result;
+}
+
+static void kv_cache_flush_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	(void)kv_cache_flush_locked();
+	k_mutex_unlock(&kv_cache_lock);
+}
+
+static struct kv_cache_entry *kv_cache_alloc(uint16_t group, uint16_t key)
+{
+	struct kv_cache_entry *victim = NULL;
+
+	for (int pass = 0; pass < 2 && !victim; pass++) {
+		for (size_t i = 0; i < ARRAY_SIZE(kv_cache); i++) {
+			if (!kv_cache[i].used) {
+				victim = &kv_cache[i];
+				break;
+			}
+			if (!kv_cache[i].dirty &&
+			    (!victim || kv_cache[i].last_use < victim->last_use)) {
+				victim = &kv_cache[i];
+			}
+		}
+		if (!victim) {
+			/* every record waits for the flash, write them to make room */
+			(void)kv_cache_flush_locked();
+		}
+	}
+	if (!victim) {
+		return NULL;
+	}
+
+	*victim = (struct kv_cache_entry){
+		.group = group, .key = key, .used = true, .last_use = ++kv_cache_clock
+	};
+	return victim;
+}
+
+static void kv_cache_mark_dirty(struct kv_cache_entry *entry)
+{
+	if (entry->dirty) {
+		/* the previous value never reaches the flash */
+		kv_stats.writes_avoided++;
+		return;
+	}
+	entry->dirty = true;
+
+	size_t dirty = 0;
+	for (size_t i = 0; i < ARRAY_SIZE(kv_cache); i++) {
+		dirty += (kv_cache[i].used && kv_cache[i].dirty);
+	}
+	if (dirty >= CONFIG_SIDEWALK_STORAGE_KV_CACHE_DIRTY_MAX) {
+		(void)k_work_cancel_delayable(&kv_cache_flush_work);
+		(void)kv_cache_flush_locked();
+		return;
+	}
+	/* the delay runs from the oldest change */
+	(void)k_work_schedule(&kv_cache_flush_work,
+			      K_MSEC(CONFIG_SIDEWALK_STORAGE_KV_CACHE_FLUSH_DELAY_MS));
+}
+
+static sid_error_t kv_cache_get(uint16_t group, uint16_t key, void *p_data, uint32_t len)
+{
+	sid_error_t result;
+
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	struct kv_cache_entry *entry = kv_cache_find(group, key);
+	if (entry) {
+		kv_stats.read_hits++;
+		uint32_t copy = MIN(len, entry->len);
+		if (entry->present && copy > 0) {
+			memcpy(p_data, entry->data, copy);
+			result = SID_ERROR_NONE;
+		} else {
+			result = SID_ERROR_NOT_FOUND;
+		}
+		k_mutex_unlock(&kv_cache_lock);
+		return result;
+	}
+
+	kv_stats.read_misses++;
+	/* one byte more to find records too long for the cache */
+	uint8_t value[SID_PAL_KV_STORE_MAX_LENGTH_BYTES + 1];
+	int rc = sid_storage_backend_read(group, key, value, sizeof(value));
+	if (rc > (int)sizeof(entry->data)) {
+		k_mutex_unlock(&kv_cache_lock);
+		return storage_record_get(group, key, p_data, len);
+	}
+	if (rc == -ENOENT) {
+		/* remember the record is missing, the stack asks for it again */
+		(void)kv_cache_alloc(group, key);
+		result = SID_ERROR_NOT_FOUND;
+	} else if (rc <= 0) {
+		result = SID_ERROR_NOT_FOUND;
+	} else {
+		entry = kv_cache_alloc(group, key);
+		if (entry) {
+			entry->present = true;
+			entry->len = rc;
+			memcpy(entry->data, value, rc);
+		}
+		uint32_t copy = MIN(len, (uint32_t)rc);
+		memcpy(p_data, value, copy);
+		result = copy > 0 ? SID_ERROR_NONE : SID_ERROR_NOT_FOUND;
+	}
+	k_mutex_unlock(&kv_cache_lock);
+	return result;
+}
+
+static sid_error_t kv_cache_get_len(uint16_t group, uint16_t key, uint32_t *p_len)
+{
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	struct kv_cache_entry *entry = kv_cache_find(group, key);
+	if (entry) {
+		kv_stats.read_hits++;
+		*p_len = entry->present ? entry->len : 0;
+		k_mutex_unlock(&kv_cache_lock);
+		return entry->present ? SID_ERROR_NONE : SID_ERROR_NOT_FOUND;
+	}
+	kv_stats.read_misses++;
+	k_mutex_unlock(&kv_cache_lock);
+
+	return storage_record_get_len(group, key, p_len);
+}
+
+static sid_error_t kv_cache_set(uint16_t group, uint16_t key, void const *p_data, uint32_t len)
+{
+	sid_error_t result = SID_ERROR_NONE;
+
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	kv_stats.sets++;
+	struct kv_cache_entry *entry = kv_cache_find(group, key);
+	if (len > sizeof(entry->data)) {
+		/* too long for the cache, write through */
+		if (entry) {
+			entry->used = false;
+		}
+		if (sid_storage_backend_write(group, key, p_data, len) != 0) {
+			result = SID_ERROR_STORAGE_WRITE_FAIL;
+		} else {
+			kv_stats.flash_writes++;
+			result = sid_storage_backend_commit() == 0 ? SID_ERROR_NONE :
+								      SID_ERROR_GENERIC;
+			kv_stats.commits++;
+		}
+		k_mutex_unlock(&kv_cache_lock);
+		return result;
+	}
+
+	if (entry && entry->present && entry->len == len && memcmp(entry->data, p_data, len) == 0) {
+		kv_stats.writes_avoided++;
+		k_mutex_unlock(&kv_cache_lock);
+		return SID_ERROR_NONE;
+	}
+
+	if (!entry) {
+		entry = kv_cache_alloc(group, key);
+	}
+	if (!entry) {
+		k_mutex_unlock(&kv_cache_lock);
+		return SID_ERROR_STORAGE_WRITE_FAIL;
+	}
+	entry->present = true;
+	entry->len = len;
+	memcpy(entry->data, p_data, len);
+	kv_cache_mark_dirty(entry);
+	k_mutex_unlock(&kv_cache_lock);
+	return result;
+}
+
+static sid_error_t kv_cache_delete(uint16_t group, uint16_t key)
+{
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	struct kv_cache_entry *entry = kv_cache_find(group, key);
+	if (entry && !entry->present && !entry->dirty) {
+		k_mutex_unlock(&kv_cache_lock);
+		return SID_ERROR_NONE;
+	}
+	if (!entry) {
+		entry = kv_cache_alloc(group, key);
 	}
+	if (!entry) {
+		k_mutex_unlock(&kv_cache_lock);
+		return sid_storage_backend_delete(group, key) == 0 ? SID_ERROR_NONE : SID_ERROR_GENERIC;
+	}
+	entry->present = false;
+	entry->len = 0;
+	kv_cache_mark_dirty(entry);
+	k_mutex_unlock(&kv_cache_lock);
+	return SID_ERROR_NONE;
+}
 
-	rc = settings_load();
+static void kv_cache_forget_group(uint16_t group)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(kv_cache); i++) {
+		if (kv_cache[i].used && kv_cache[i].group == group) {
+			kv_cache[i].used = false;
+		}
+	}
+}
+
+sid_error_t sid_storage_kv_flush(void)
+{
+	(void)k_work_cancel_delayable(&kv_cache_flush_work);
+
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	sid_error_t result = kv_cache_flush_locked();
+	k_mutex_unlock(&kv_cache_lock);
+	return result;
+}
+
+void sid_storage_kv_stats_get(struct sid_storage_kv_stats *stats)
+{
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	*stats = kv_stats;
+	k_mutex_unlock(&kv_cache_lock);
+}
+
+void sid_storage_kv_stats_reset(void)
+{
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	kv_stats = (struct sid_storage_kv_stats){ 0 };
+	k_mutex_unlock(&kv_cache_lock);
+}
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
+
+sid_error_t sid_pal_storage_kv_init()
+{
+	int rc = sid_storage_backend_init();
 	if (rc != 0) {
-		LOG_ERR("settings load failed (err %d)", rc);
 		return SID_ERROR_GENERIC;
 	}
 
@@ -133,6 +439,16 @@ sid_error_t sid_pal_storage_kv_init()
 	return SID_ERROR_NONE;
 }
 
+
+sid_error_t sid_pal_storage_kv_deinit(void)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	return sid_storage_kv_flush();
+#else
+	return SID_ERROR_NONE;
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
+}
+
 sid_error_t sid_pal_storage_kv_record_get(uint16_t group, uint16_t key, void *p_data, uint32_t len)
 {
 	if (!p_data) {
@@ -151,13 +467,11 @@ sid_error_t sid_pal_storage_kv_record_get(uint16_t group, uint16_t key, void *p_
 	}
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-	int rc = settings_utils_load_immediate_value(serial, p_data, len);
-	if (rc <= 0) {
-		return SID_ERROR_NOT_FOUND;
-	} else
-		return SID_ERROR_NONE;
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	return kv_cache_get(group, key, p_data, len);
+#else
+	return storage_record_get(group, key, p_data, len);
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
 }
 
 sid_error_t sid_pal_storage_kv_record_get_len(uint16_t group, uint16_t key, uint32_t *p_len)
@@ -165,13 +479,12 @@ sid_error_t sid_pal_storage_kv_record_get_len(uint16_t group, uint16_t key, uint
 	if (!p_len) {
 		return SID_ERROR_NULL_POINTER;
 	}
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-	int rc = settings_utils_get_value_size(serial, p_len);
-	if (rc < 0 || *p_len == 0)
-		return SID_ERROR_NOT_FOUND;
-	else
-		return SID_ERROR_NONE;
+
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	return kv_cache_get_len(group, key, p_len);
+#else
+	return storage_record_get_len(group, key, p_len);
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
 }
 
 sid_error_t sid_pal_storage_kv_record_set(uint16_t group, uint16_t key, void const *p_data,
@@ -200,21 +513,18 @@ sid_error_t sid_pal_storage_kv_record_set(uint16_t group, uint16_t key, void con
 	}
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-
-	int rc = settings_save_one(serial, (const void *)p_data, len);
-	if (rc != 0) {
-		LOG_ERR("Failed to save record (%s). Returned errno %d", serial, rc);
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	return kv_cache_set(group, key, p_data, len);
+#else
+	if (sid_storage_backend_write(group, key, p_data, len) != 0) {
 		return SID_ERROR_STORAGE_WRITE_FAIL;
 	}
 
-	rc = settings_commit();
-	if (rc != 0) {
-		LOG_ERR("Failed to commit changes. Returned errno %d", rc);
+	if (sid_storage_backend_commit() != 0) {
 		return SID_ERROR_GENERIC;
 	}
 	return SID_ERROR_NONE;
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
 }
 
 sid_error_t sid_pal_storage_kv_record_delete(uint16_t group, uint16_t key)
@@ -227,54 +537,36 @@ sid_error_t sid_pal_storage_kv_record_delete(uint16_t group, uint16_t key)
 	}
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-	int rc = settings_delete(serial);
-	if (rc == 0) {
-		return SID_ERROR_NONE;
-	}
-	LOG_ERR("Failed to delete record (%s). Returned errno %d", serial, rc);
-	return SID_ERROR_GENERIC;
-}
-
-int delete_subtree_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
-		      void *param)
-{
-	char *subtree = (char *)param;
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	snprintf(serial, sizeof(serial), "%s/%s", subtree, key);
-	int rc = settings_delete(serial);
-	if (rc != 0) {
-		LOG_ERR("Failed to delete record. Returned errno %d", rc);
-		return rc;
-	}
-	return 0;
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	return kv_cache_delete(group, key);
+#else
+	return sid_storage_backend_delete(group, key) == 0 ? SID_ERROR_NONE : SID_ERROR_GENERIC;
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
 }
 
 sid_error_t sid_pal_storage_kv_group_delete(uint16_t group)
 {
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group(serial, sizeof(serial), group);
-	int rc = settings_load_subtree_direct(serial, delete_subtree_cb, (void *)serial);
-	if (rc != 0) {
-		LOG_ERR("Failed to delete group. Returned errno %d", rc);
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	k_mutex_lock(&kv_cache_lock, K_FOREVER);
+	kv_cache_forget_group(group);
+	k_mutex_unlock(&kv_cache_lock);
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_CACHE */
+
+	if (sid_storage_backend_group_delete(group) != 0) {
 		return SID_ERROR_STORAGE_ERASE_FAIL;
 	}
-	rc = settings_commit();
-	if (rc != 0) {
-		LOG_ERR("Failed to commit changes. Returned errno %d", rc);
-		return SID_ERROR_GENERIC;
-	}
 
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-	bool success = true;
 	if (STORAGE_KV_INTERNAL_PROTOCOL_GROUP_ID == group) {
-		success = success && storage_key_delete_secure(SID_CRYPTO_KV_WAN_MASTER_KEY_ID);
-		success = success && storage_key_delete_secure(SID_CRYPTO_KV_APP_KEY_KEY_ID);
-		success = success && storage_key_delete_secure(SID_CRYPTO_KV_D2D_KEY_ID);
-	}
-	if (!success) {
-		return SID_ERROR_STORAGE_ERASE_FAIL;
+		/* factory reset, destroy all master keys even if one of them fails */
+		static const psa_key_id_t master_keys[] = { SID_CRYPTO_KV_WAN_MASTER_KEY_ID,
+							    SID_CRYPTO_KV_APP_KEY_KEY_ID,
+							    SID_CRYPTO_KV_D2D_KEY_ID };
+		int err = sid_crypto_keys_delete_batch(master_keys, ARRAY_SIZE(master_keys));
+		if (err) {
+			LOG_ERR("Failed to delete secure keys. Returned errno %d", err);
+			return SID_ERROR_STORAGE_ERASE_FAIL;
+		}
 	}
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_settings.c
+ *  @brief Sidewalk key-value storage records as Zephyr settings.
+ */
+
+#include <sid_storage_backend.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <settings_utils.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sid_storage_settings, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define STORAGE_SERIAL_SIZE (32)
+#define STORAGE_SERIAL_PREFIX "sidewalk/storage/"
+
+/* "sidewalk/storage/gggg/kkkk" */
+BUILD_ASSERT(STORAGE_SERIAL_SIZE >= sizeof(STORAGE_SERIAL_PREFIX) + 2 * 4 + 1);
+
+/* Keys are formatted on every access, faster without snprintf */
+static char *serialize_hex16(char *serial, uint16_t value)
+{
+	static const char digits[] = "0123456789abcdef";
+
+	for (int shift = 12; shift >= 0; shift -= 4) {
+		*serial++ = digits[(value >> shift) & 0xf];
+	}
+	return serial;
+}
+
+static void settings_serialize_group(char serial[STORAGE_SERIAL_SIZE], uint16_t group)
+{
+	memcpy(serial, STORAGE_SERIAL_PREFIX, sizeof(STORAGE_SERIAL_PREFIX) - 1);
+	*serialize_hex16(serial + sizeof(STORAGE_SERIAL_PREFIX) - 1, group) = '\0';
+}
+
+static void settings_serialize_group_key(char serial[STORAGE_SERIAL_SIZE], uint16_t group,
+					 uint16_t key)
+{
+	memcpy(serial, STORAGE_SERIAL_PREFIX, sizeof(STORAGE_SERIAL_PREFIX) - 1);
+	char *end = serialize_hex16(serial + sizeof(STORAGE_SERIAL_PREFIX) - 1, group);
+	*end++ = '/';
+	*serialize_hex16(end, key) = '\0';
+}
+
+int sid_storage_backend_init(void)
+{
+	int rc = settings_subsys_init();
+	if (rc != 0) {
+		LOG_ERR("settings init failed (err %d)", rc);
+		return rc;
+	}
+
+	rc = settings_load();
+	if (rc != 0) {
+		LOG_ERR("settings load failed (err %d)", rc);
+	}
+	return rc;
+}
+
+int sid_storage_backend_read(uint16_t group, uint16_t key, void *data, uint32_t len)
+{
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group_key(serial, group, key);
+	int rc = settings_utils_load_immediate_value(serial, data, len);
+	return rc == 0 ? -ENOENT : rc;
+}
+
+int sid_storage_backend_len(uint16_t group, uint16_t key, uint32_t *len)
+{
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group_key(serial, group, key);
+	size_t value_len = 0;
+	int rc = settings_utils_get_value_size(serial, &value_len);
+	if (rc < 0) {
+		return rc;
+	}
+	*len = value_len;
+	return value_len == 0 ? -ENOENT : 0;
+}
+
+int sid_storage_backend_write(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group_key(serial, group, key);
+
+	int rc = settings_save_one(serial, data, len);
+	if (rc != 0) {
+		LOG_ERR("Failed to save record (%s). Returned errno %d", serial, rc);
+	}
+	return rc;
+}
+
+int sid_storage_backend_delete(uint16_t group, uint16_t key)
+{
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group_key(serial, group, key);
+	int rc = settings_delete(serial);
+	if (rc != 0) {
+		LOG_ERR("Failed to delete record (%s). Returned errno %d", serial, rc);
+	}
+	return rc;
+}
+
+int sid_storage_backend_commit(void)
+{
+	int rc = settings_commit();
+	if (rc != 0) {
+		LOG_ERR("Failed to commit changes. Returned errno %d", rc);
+	}
+	return rc;
+}
+
+static int delete_subtree_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			     void *param)
+{
+	char *subtree = (char *)param;
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	snprintf(serial, sizeof(serial), "%s/%s", subtree, key);
+	int rc = settings_delete(serial);
+	if (rc != 0) {
+		LOG_ERR("Failed to delete record. Returned errno %d", rc);
+		return rc;
+	}
+	return 0;
+}
+
+int sid_storage_backend_group_delete(uint16_t group)
+{
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group(serial, group);
+	int rc = settings_load_subtree_direct(serial, delete_subtree_cb, (void *)serial);
+	if (rc != 0) {
+		LOG_ERR("Failed to delete group. Returned errno %d", rc);
+		return rc;
+	}
+	return sid_storage_backend_commit();
+}
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_zms.c
+ *  @brief Sidewalk key-value storage records in ZMS with numeric IDs.
+ *
+ * A record is stored under the ID (group << 16 | key), so it is found by the ZMS lookup
+ * without any name formatting or search. ZMS cannot list its IDs, every group has
+ * a directory record with the keys ever written to it, used by the group delete.
+ *
+ * The group delete writes the directory to a single pending delete record, a tombstone of the
+ * whole group, and returns. The records of the group are not found from then on, and they are
+ * deleted one by one by a work item, or before the next change of the storage. A reset in the
+ * middle leaves the pending record, and the delete is finished after the next initialization,
+ * so the group is never left half deleted.
+ */
+
+#include <sid_storage_backend.h>
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/zms.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sid_storage_zms, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define KV_PARTITION sid_kv_partition
+
+/* The upper half of the ID space keeps the metadata, groups are limited to 15 bits */
+#define KV_GROUP_MAX (0x7fff)
+#define KV_META_ID BIT(31)
+#define KV_RECORD_ID(group, key) (((uint32_t)(group) << 16) | (key))
+#define KV_GROUP_DIR_ID(group) (KV_META_ID | (group))
+#define KV_GROUP_DELETE_ID (KV_META_ID | 0xffff)
+
+#define KV_GROUP_KEYS_MAX CONFIG_SIDEWALK_STORAGE_KV_ZMS_GROUP_KEYS_MAX
+
+static struct zms_fs kv_fs;
+static K_MUTEX_DEFINE(kv_lock);
+
+#define KV_NO_PENDING (-1)
+
+/* Pending delete record: the group followed by its keys */
+static uint16_t kv_group_buf[1 + KV_GROUP_KEYS_MAX];
+/* Group of the pending delete record, its keys stay in kv_group_buf until it is finished */
+static int kv_pending_group = KV_NO_PENDING;
+static size_t kv_pending_count;
+
+static void kv_group_delete_work_handler(struct k_work *work);
+static K_WORK_DEFINE(kv_group_delete_work, kv_group_delete_work_handler);
+
+static int kv_dir_read(uint16_t group, uint16_t *keys)
+{
+	ssize_t rc = zms_read(&kv_fs, KV_GROUP_DIR_ID(group), keys,
+			      KV_GROUP_KEYS_MAX * sizeof(uint16_t));
+	if (rc == -ENOENT) {
+		return 0;
+	}
+	if (rc < 0) {
+		LOG_ERR("Failed to read group %04x directory. Returned errno %d", group, (int)rc);
+		return rc;
+	}
+	return MIN((size_t)rc, KV_GROUP_KEYS_MAX * sizeof(uint16_t)) / sizeof(uint16_t);
+}
+
+static int kv_dir_add(uint16_t group, uint16_t key)
+{
+	uint16_t *keys = &kv_group_buf[1];
+	int count = kv_dir_read(group, keys);
+	if (count < 0) {
+		return count;
+	}
+
+	for (int i = 0; i < count; i++) {
+		if (keys[i] == key) {
+			return 0;
+		}
+	}
+	if (count == KV_GROUP_KEYS_MAX) {
+		LOG_ERR("Group %04x directory is full", group);
+		return -ENOSPC;
+	}
+
+	keys[count++] = key;
+	ssize_t rc = zms_write(&kv_fs, KV_GROUP_DIR_ID(group), keys, count * sizeof(uint16_t));
+	return rc < 0 ? rc : 0;
+}
+
+/* Idempotent, run again after a reset */
+static int kv_group_delete_apply(const uint16_t *pending, size_t count)
+{
+	const uint16_t group = pending[0];
+
+	for (size_t i = 1; i < count; i++) {
+		int rc = zms_delete(&kv_fs, KV_RECORD_ID(group, pending[i]));
+		if (rc != 0) {
+			LOG_ERR("Failed to delete record %04x/%04x. Returned errno %d", group,
+				pending[i], rc);
+			return rc;
+		}
+	}
+
+	int rc = zms_delete(&kv_fs, KV_GROUP_DIR_ID(group));
+	if (rc == 0) {
+		rc = zms_delete(&kv_fs, KV_GROUP_DELETE_ID);
+	}
+	return rc;
+}
+
+/* Called with kv_lock held, before anything else uses kv_group_buf */
+static int kv_group_delete_finish(void)
+{
+	if (kv_pending_group == KV_NO_PENDING) {
+		return 0;
+	}
+
+	int rc = kv_group_delete_apply(kv_group_buf, kv_pending_count);
+	if (rc != 0) {
+		LOG_ERR("Failed to finish delete of group %04x. Returned errno %d",
+			kv_pending_group, rc);
+		return rc;
+	}
+	kv_pending_group = KV_NO_PENDING;
+	return 0;
+}
+
+static void kv_group_delete_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&kv_lock, K_FOREVER);
+	(void)kv_group_delete_finish();
+	k_mutex_unlock(&kv_lock);
+}
+
+/* The upper half of the ID space keeps the metadata, a group has 15 bits */
+static int kv_group_check(uint16_t group)
+{
+	if (group > KV_GROUP_MAX) {
+		LOG_ERR("Group %04x out of range", group);
+		return -EINVAL;
+	}
+	return 0;
+}
+
+static bool kv_group_deleted(uint16_t group)
+{
+	return kv_pending_group == group;
+}
+
+static int kv_group_delete_recover(void)
+{
+	ssize_t rc = zms_read(&kv_fs, KV_GROUP_DELETE_ID, kv_group_buf, sizeof(kv_group_buf));
+	if (rc == -ENOENT) {
+		return 0;
+	}
+	if (rc < (ssize_t)sizeof(uint16_t)) {
+		LOG_ERR("Failed to read pending group delete. Returned errno %d", (int)rc);
+		return rc < 0 ? rc : -EIO;
+	}
+
+	kv_pending_count = MIN((size_t)rc, sizeof(kv_group_buf)) / sizeof(uint16_t);
+	kv_pending_group = kv_group_buf[0];
+	LOG_WRN("Finishing interrupted delete of group %04x", kv_pending_group);
+	(void)k_work_submit(&kv_group_delete_work);
+	return 0;
+}
+
+int sid_storage_backend_init(void)
+{
+	struct flash_pages_info info;
+	int rc;
+
+	k_mutex_lock(&kv_lock, K_FOREVER);
+	if (kv_fs.ready) {
+		k_mutex_unlock(&kv_lock);
+		return 0;
+	}
+
+	kv_fs.flash_device = FIXED_PARTITION_DEVICE(KV_PARTITION);
+	if (!device_is_ready(kv_fs.flash_device)) {
+		LOG_ERR("Flash device is not ready");
+		k_mutex_unlock(&kv_lock);
+		return -ENODEV;
+	}
+
+	kv_fs.offset = FIXED_PARTITION_OFFSET(KV_PARTITION);
+	rc = flash_get_page_info_by_offs(kv_fs.flash_device, kv_fs.offset, &info);
+	if (rc == 0) {
+		kv_fs.sector_size = info.size;
+		kv_fs.sector_count = FIXED_PARTITION_SIZE(KV_PARTITION) / info.size;
+		rc = zms_mount(&kv_fs);
+	}
+	if (rc == 0) {
+		rc = kv_group_delete_recover();
+	}
+	if (rc != 0) {
+		LOG_ERR("ZMS init failed (err %d)", rc);
+	}
+	k_mutex_unlock(&kv_lock);
+	return rc;
+}
+
+int sid_storage_backend_read(uint16_t group, uint16_t key, void *data, uint32_t len)
+{
+	if (kv_group_check(group)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&kv_lock, K_FOREVER);
+	ssize_t rc = kv_group_deleted(group) ? -ENOENT :
+						 zms_read(&kv_fs, KV_RECORD_ID(group, key), data, len);
+	k_mutex_unlock(&kv_lock);
+	if (rc < 0) {
+		return rc;
+	}
+	return MIN((uint32_t)rc, len);
+}
+
+int sid_storage_backend_len(uint16_t group, uint16_t key, uint32_t *len)
+{
+	if (kv_group_check(group)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&kv_lock, K_FOREVER);
+	ssize_t rc = kv_group_deleted(group) ? -ENOENT :
+						 zms_get_data_length(&kv_fs, KV_RECORD_ID(group, key));
+	k_mutex_unlock(&kv_lock);
+	if (rc < 0) {
+		return rc;
+	}
+	*len = rc;
+	return rc == 0 ? -ENOENT : 0;
+}
+
+int sid_storage_backend_write(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+	if (kv_group_check(group)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&kv_lock, K_FOREVER);
+	ssize_t rc = kv_group_delete_finish();
+	if (rc == 0) {
+		/* the directory lists the key before the record exists, the group delete finds it */
+		rc = zms_get_data_length(&kv_fs, KV_RECORD_ID(group, key));
+	}
+	if (rc == -ENOENT) {
+		rc = kv_dir_add(group, key);
+	}
+	if (rc >= 0) {
+		rc = zms_write(&kv_fs, KV_RECORD_ID(group, key), data, len);
+	}
+	k_mutex_unlock(&kv_lock);
+
+	if (rc < 0) {
+		LOG_ERR("Failed to save record %04x/%04x. Returned errno %d", group, key, (int)rc);
+		return rc;
+	}
+	return 0;
+}
+
+int sid_storage_backend_delete(uint16_t group, uint16_t key)
+{
+	if (kv_group_check(group)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&kv_lock, K_FOREVER);
+	int rc = 0;
+	if (!kv_group_deleted(group)) {
+		/* the key stays in the directory, deleting it again is harmless */
+		rc = zms_delete(&kv_fs, KV_RECORD_ID(group, key));
+	}
+	k_mutex_unlock(&kv_lock);
+	if (rc != 0) {
+		LOG_ERR("Failed to delete record %04x/%04x. Returned errno %d", group, key, rc);
+	}
+	return rc;
+}
+
+int sid_storage_backend_commit(void)
+{
+	/* ZMS writes are persistent when they return */
+	return 0;
+}
+
+int sid_storage_backend_group_delete(uint16_t group)
+{
+	if (kv_group_check(group)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&kv_lock, K_FOREVER);
+	if (kv_group_deleted(group)) {
+		k_mutex_unlock(&kv_lock);
+		return 0;
+	}
+	/* one pending delete record at a time */
+	int count = kv_group_delete_finish();
+	if (count == 0) {
+		count = kv_dir_read(group, &kv_group_buf[1]);
+	}
+	if (count <= 0) {
+		k_mutex_unlock(&kv_lock);
+		return count;
+	}
+
+	kv_group_buf[0] = group;
+	ssize_t rc = zms_write(&kv_fs, KV_GROUP_DELETE_ID, kv_group_buf,
+			       (1 + count) * sizeof(uint16_t));
+	if (rc >= 0) {
+		kv_pending_group = group;
+		kv_pending_count = 1 + count;
+		(void)k_work_submit(&kv_group_delete_work);
+	}
+	k_mutex_unlock(&kv_lock);
+
+	if (rc < 0) {
+		LOG_ERR("Failed to delete group %04x. Returned errno %d", group, (int)rc);
+		return rc;
+	}
+	return 0;
+}
@@ -9,6 +9,7 @@
  */
 
 #include <sid_pal_swi_ifc.h>
+#include <sid_timer_dispatch.h>
 #include <zephyr/kernel.h>
 
 #ifndef CONFIG_SIDEWALK_SWI_PRIORITY
@@ -21,6 +22,13 @@
 
 static K_SEM_DEFINE(swi_trigger_sem, 0, 1);
 
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI
+#define SWI_EVENT_TRIGGER BIT(0)
+#define SWI_EVENT_TIMER BIT(1)
+
+static atomic_t swi_events;
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI */
+
 static sid_pal_swi_cb_t swi_cb;
 static bool is_init = false;
 
@@ -65,10 +73,21 @@ sid_error_t sid_pal_swi_trigger(void)
 		return SID_ERROR_INVALID_STATE;
 	}
 
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI
+	atomic_or(&swi_events, SWI_EVENT_TRIGGER);
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI */
 	k_sem_give(&swi_trigger_sem);
 	return SID_ERROR_NONE;
 }
 
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI
+void sid_pal_swi_timer_notify(void)
+{
+	atomic_or(&swi_events, SWI_EVENT_TIMER);
+	k_sem_give(&swi_trigger_sem);
+}
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI */
+
 static void swi_task(void *arg1, void *arg2, void *arg3)
 {
 	ARG_UNUSED(arg1);
@@ -77,6 +96,16 @@ static void swi_task(void *arg1, void *arg2, void *arg3)
 
 	while (1) {
 		k_sem_take(&swi_trigger_sem, K_FOREVER);
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI
+		const atomic_val_t events = atomic_clear(&swi_events);
+
+		if (events & SWI_EVENT_TIMER) {
+			sid_timer_dispatch_ready();
+		}
+		if (!(events & SWI_EVENT_TRIGGER)) {
+			continue;
+		}
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI */
 		if (swi_cb) {
 			swi_cb();
 		}
@@ -13,6 +13,10 @@
 #include <sid_pal_assert_ifc.h>
 #include <sid_pal_critical_region_ifc.h>
 #include <sid_time_ops.h>
+#include <sid_timer_queue.h>
+#include <sid_timer_ext.h>
+#include <sid_timer_dispatch.h>
+#include <sid_uptime_ext.h>
 #include <stdint.h>
 #include <zephyr/kernel.h>
 
@@ -28,47 +32,153 @@
 static K_SEM_DEFINE(timer_trigger_sem, 0, 1);
 #endif /* CONFIG_SIDEWALK_THREAD_TIMER */
 
-struct sid_pal_timer_ctx {
-	sys_dlist_t list;
-};
+/* Prebuilt Sidewalk libraries allocate timers with the size of the original storage */
+BUILD_ASSERT(sizeof(sid_pal_timer_t) ==
+		     2 * sizeof(struct sid_timespec) + sizeof(sys_dnode_t) + 3 * sizeof(void *),
+	     "sid_pal_timer_t size must not change");
+BUILD_ASSERT(CONFIG_SIDEWALK_TIMER_LOWPOWER_SLACK_MS <= SID_PAL_TIMER_SLACK_MS_MAX);
+
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+static struct sid_timer_stats timer_stats;
+#define TIMER_STATS_INC(name) (timer_stats.name++)
+#else
+#define TIMER_STATS_INC(name)
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+
+#ifdef CONFIG_SIDEWALK_TIMER_LATENCY_STATS
+static struct sid_timer_latency_stats latency_stats;
+
+static void sid_timer_latency_record(uint32_t *histogram, uint32_t *max_us, uint32_t delay_us)
+{
+	const uint32_t bucket = delay_us ? 32 - __builtin_clz(delay_us) : 0;
+
+	histogram[MIN(bucket, SID_TIMER_LATENCY_BUCKETS - 1)]++;
+	*max_us = MAX(*max_us, delay_us);
+}
+#endif /* CONFIG_SIDEWALK_TIMER_LATENCY_STATS */
 
-static const struct sid_timespec tolerance_lowpower = { .tv_sec = 1, .tv_nsec = 0 };
-static const struct sid_timespec tolerance_precise = { .tv_sec = 0, .tv_nsec = 0 };
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_SIDEWALK_TIMER_READY_RING_SIZE),
+	     "CONFIG_SIDEWALK_TIMER_READY_RING_SIZE must be a power of two");
 
-static struct sid_pal_timer_ctx sid_pal_timer_ctx = {
-	.list = SYS_DLIST_STATIC_INIT(&sid_pal_timer_ctx.list),
+#define READY_RING_MASK (CONFIG_SIDEWALK_TIMER_READY_RING_SIZE - 1)
+
+/*
+ * Expired timers waiting for the worker. Entries are added by the expiry handler in the
+ * critical region. The worker and cancel take entries with an atomic exchange, so running
+ * the callbacks does not need the critical region.
+ */
+struct sid_timer_ready {
+	atomic_ptr_t timer;
+	uint32_t fire_cycles;
 };
 
-static void sid_timer_start(const struct sid_timespec *sid_time);
+static struct sid_timer_ready ready_ring[CONFIG_SIDEWALK_TIMER_READY_RING_SIZE];
+static atomic_t ready_head;
+static atomic_t ready_tail;
+/* Set when the ring was full and expired timers are left in the queue */
+static atomic_t ready_overflow;
 
-static const struct sid_timespec *sid_pal_timer_get_tolerance(sid_pal_timer_prio_class_t type)
+static bool sid_timer_ready_push(sid_pal_timer_t *timer)
 {
-	const struct sid_timespec *tolerance = NULL;
+	const atomic_val_t head = atomic_get(&ready_head);
+
+	if ((uint32_t)(head - atomic_get(&ready_tail)) >= CONFIG_SIDEWALK_TIMER_READY_RING_SIZE) {
+		return false;
+	}
+
+	struct sid_timer_ready *entry = &ready_ring[head & READY_RING_MASK];
+
+	entry->fire_cycles = k_cycle_get_32();
+	atomic_ptr_set(&entry->timer, timer);
+	atomic_inc(&ready_head);
+
+	return true;
+}
 
+static sid_pal_timer_t *sid_timer_ready_pop(uint32_t *fire_cycles)
+{
+	atomic_val_t tail;
+
+	while ((tail = atomic_get(&ready_tail)) != atomic_get(&ready_head)) {
+		struct sid_timer_ready *entry = &ready_ring[tail & READY_RING_MASK];
+		sid_pal_timer_t *timer = atomic_ptr_clear(&entry->timer);
+
+		*fire_cycles = entry->fire_cycles;
+		atomic_inc(&ready_tail);
+		if (timer) {
+			return timer;
+		}
+	}
+
+	return NULL;
+}
+
+/* Drop the pending callbacks of the timer, entries already taken by the worker still run */
+static void sid_timer_ready_cancel(const sid_pal_timer_t *timer)
+{
+	for (atomic_val_t i = atomic_get(&ready_tail); i != atomic_get(&ready_head); i++) {
+		(void)atomic_ptr_cas(&ready_ring[i & READY_RING_MASK].timer,
+				     (atomic_ptr_val_t)timer, NULL);
+	}
+}
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED */
+
+static void sid_timer_start(const struct sid_timespec *sid_time);
+
+static uint16_t sid_pal_timer_get_slack_ms(sid_pal_timer_prio_class_t type)
+{
 	switch (type) {
 	case SID_PAL_TIMER_PRIO_CLASS_PRECISE:
-		tolerance = &tolerance_precise;
-		break;
-
+		return 0;
 	case SID_PAL_TIMER_PRIO_CLASS_LOWPOWER:
-		tolerance = &tolerance_lowpower;
-		break;
+		return CONFIG_SIDEWALK_TIMER_LOWPOWER_SLACK_MS;
 	}
 
-	SID_PAL_ASSERT(tolerance);
+	SID_PAL_ASSERT(false);
 
-	return tolerance;
+	return 0;
 }
 
+static struct sid_timespec sid_timer_ms_to_timespec(uint64_t ms)
+{
+	return (struct sid_timespec){
+		.tv_sec = (sid_time_t)(ms / MSEC_PER_SEC),
+		.tv_nsec = (uint32_t)(ms % MSEC_PER_SEC) * NSEC_PER_MSEC,
+	};
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_SLACK_ALIGN
+/*
+ * Move the alarm to the point in [alarm, alarm + slack] with the most trailing zero bits
+ * in milliseconds, so unrelated timers with overlapping windows expire together.
+ * Returns the delay applied in milliseconds, rounded down.
+ */
+static uint16_t sid_timer_slack_align(struct sid_timespec *alarm, uint16_t slack_ms)
+{
+	uint64_t start = (uint64_t)alarm->tv_sec * MSEC_PER_SEC +
+			 DIV_ROUND_UP(alarm->tv_nsec, NSEC_PER_MSEC);
+	uint64_t limit = (uint64_t)alarm->tv_sec * MSEC_PER_SEC + alarm->tv_nsec / NSEC_PER_MSEC +
+			 slack_ms;
+
+	if (start >= limit) {
+		return 0;
+	}
+
+	limit &= ~(BIT64(63 - __builtin_clzll(start ^ limit)) - 1);
+	*alarm = sid_timer_ms_to_timespec(limit);
+
+	return (uint16_t)(limit - start);
+}
+#endif /* CONFIG_SIDEWALK_TIMER_SLACK_ALIGN */
+
 static bool sid_pal_timer_list_in_list(const sid_pal_timer_t *timer)
 {
 	SID_PAL_ASSERT(timer);
-	bool result = true;
+	bool result;
 
 	sid_pal_enter_critical_region();
-	if ((0 == timer->node.next) && (0 == timer->node.prev)) {
-		result = false;
-	}
+	result = sid_timer_queue_contains(timer);
 	sid_pal_exit_critical_region();
 
 	return result;
@@ -79,70 +189,123 @@ static void sid_pal_timer_list_delete(sid_pal_timer_t *timer)
 	SID_PAL_ASSERT(timer);
 
 	sid_pal_enter_critical_region();
-	if (!((0 == timer->node.next) && (0 == timer->node.prev))) {
-		sys_dlist_remove(&timer->node);
-	}
+	sid_timer_queue_remove(timer);
 	sid_pal_exit_critical_region();
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED
+	sid_timer_ready_cancel(timer);
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED */
 }
 
-static void sid_pal_timer_list_insert(struct sid_pal_timer_ctx *ctx, sid_pal_timer_t *timer)
+/*
+ * Expire the timer together with the next scheduled timer if that one is within the slack.
+ * Otherwise a timer with slack may be aligned to a wake window boundary.
+ */
+static void sid_pal_timer_list_insert(sid_pal_timer_t *timer)
 {
-	SID_PAL_ASSERT(ctx && timer);
-	bool reschedule_required = true;
+	SID_PAL_ASSERT(timer);
+	bool coalesced __maybe_unused = false;
+
+	timer->deferred_ms = 0;
 
 	sid_pal_enter_critical_region();
-	sys_dnode_t *node = sys_dlist_peek_head(&ctx->list);
-
-	while (node) {
-		sid_pal_timer_t *element = CONTAINER_OF(node, __typeof__(*element), node);
-		if (sid_time_gt(&element->alarm, &timer->alarm)) {
-			struct sid_timespec diff = element->alarm;
-			sid_time_sub(&diff, &timer->alarm);
-			if (!sid_time_gt(&diff, timer->tolerance)) {
-				reschedule_required = false;
-				timer->alarm = element->alarm;
+	sid_pal_timer_t *head = sid_timer_queue_peek();
+	sid_pal_timer_t *next = sid_timer_queue_find_later(&timer->alarm);
+
+	if (next && timer->slack_ms) {
+		struct sid_timespec diff = next->alarm;
+		const struct sid_timespec slack = sid_timer_ms_to_timespec(timer->slack_ms);
+
+		sid_time_sub(&diff, &timer->alarm);
+		if (!sid_time_gt(&diff, &slack)) {
+			coalesced = true;
+			timer->alarm = next->alarm;
+			timer->deferred_ms = (uint16_t)(diff.tv_sec * MSEC_PER_SEC +
+							diff.tv_nsec / NSEC_PER_MSEC);
+			TIMER_STATS_INC(coalesced);
+			if (next == head) {
+				TIMER_STATS_INC(reprograms_avoided);
 			}
-			sys_dlist_append(&element->node, &timer->node);
-			break;
 		}
-		reschedule_required = false;
-		node = sys_dlist_peek_next_no_check(&ctx->list, node);
 	}
-
-	if (!node) {
-		sys_dlist_append(&ctx->list, &timer->node);
+#ifdef CONFIG_SIDEWALK_TIMER_SLACK_ALIGN
+	if (!coalesced && timer->slack_ms && !sid_time_is_infinity(&timer->alarm)) {
+		timer->deferred_ms = sid_timer_slack_align(&timer->alarm, timer->slack_ms);
+		if (timer->deferred_ms) {
+			TIMER_STATS_INC(aligned);
+		}
 	}
+#endif /* CONFIG_SIDEWALK_TIMER_SLACK_ALIGN */
+	TIMER_STATS_INC(armed);
+
+	const bool reschedule_required = !head || sid_time_gt(&head->alarm, &timer->alarm);
+
+	sid_timer_queue_insert(timer);
 	if (reschedule_required) {
 		sid_timer_start(&timer->alarm);
 	}
 	sid_pal_exit_critical_region();
 }
 
-static void sid_pal_timer_list_fetch(struct sid_pal_timer_ctx *ctx,
-				     const struct sid_timespec *non_gt_than,
+/*
+ * Timers are due at the alarm, but the ones delayed by slack may already expire
+ * at the originally requested time if the device is awake anyway.
+ */
+static bool sid_pal_timer_is_due(const sid_pal_timer_t *timer, const struct sid_timespec *now)
+{
+	struct sid_timespec earliest = timer->alarm;
+
+	if (timer->deferred_ms) {
+		const struct sid_timespec deferred = sid_timer_ms_to_timespec(timer->deferred_ms);
+
+		sid_time_sub(&earliest, &deferred);
+	}
+
+	return !sid_time_gt(&earliest, now);
+}
+
+/* Remove the due timer from the queue, the caller holds the critical region */
+static void sid_pal_timer_expire(sid_pal_timer_t *timer, const struct sid_timespec *now)
+{
+	sid_timer_queue_remove(timer);
+	TIMER_STATS_INC(expired);
+	if (sid_time_gt(&timer->alarm, now)) {
+		TIMER_STATS_INC(expired_early);
+		return;
+	}
+#ifdef CONFIG_SIDEWALK_TIMER_LATENCY_STATS
+	struct sid_timespec delay = *now;
+
+	sid_time_sub(&delay, &timer->alarm);
+	sid_timer_latency_record(latency_stats.fire_delay, &latency_stats.fire_delay_max_us,
+				 (uint32_t)MIN((uint64_t)delay.tv_sec * USEC_PER_SEC +
+						       delay.tv_nsec / NSEC_PER_USEC,
+					       UINT32_MAX));
+#endif /* CONFIG_SIDEWALK_TIMER_LATENCY_STATS */
+}
+
+static void sid_pal_timer_list_fetch(const struct sid_timespec *non_gt_than,
 				     sid_pal_timer_t **timer)
 {
-	SID_PAL_ASSERT(ctx && non_gt_than && timer);
+	SID_PAL_ASSERT(non_gt_than && timer);
 	*timer = NULL;
 
 	sid_pal_enter_critical_region();
-	sid_pal_timer_t *result = SYS_DLIST_PEEK_HEAD_CONTAINER(&ctx->list, result, node);
+	sid_pal_timer_t *result = sid_timer_queue_peek();
 
-	if (result && !sid_time_gt(&result->alarm, non_gt_than)) {
+	if (result && sid_pal_timer_is_due(result, non_gt_than)) {
 		*timer = result;
-		sys_dlist_remove(&result->node);
+		sid_pal_timer_expire(result, non_gt_than);
 	}
 	sid_pal_exit_critical_region();
 }
 
-static void sid_pal_timer_list_get_next_schedule(struct sid_pal_timer_ctx *ctx,
-						 struct sid_timespec *schedule)
+static void sid_pal_timer_list_get_next_schedule(struct sid_timespec *schedule)
 {
-	SID_PAL_ASSERT(ctx && schedule);
+	SID_PAL_ASSERT(schedule);
 	*schedule = SID_TIME_INFINITY;
 
 	sid_pal_enter_critical_region();
-	sid_pal_timer_t *result = SYS_DLIST_PEEK_HEAD_CONTAINER(&ctx->list, result, node);
+	sid_pal_timer_t *result = sid_timer_queue_peek();
 
 	if (result) {
 		*schedule = result->alarm;
@@ -178,8 +341,9 @@ sid_error_t sid_pal_timer_deinit(sid_pal_timer_t *timer_storage)
 	return SID_ERROR_NONE;
 }
 
-sid_error_t sid_pal_timer_arm(sid_pal_timer_t *timer_storage, sid_pal_timer_prio_class_t type,
-			      const struct sid_timespec *when, const struct sid_timespec *period)
+static sid_error_t sid_pal_timer_arm_internal(sid_pal_timer_t *timer_storage, uint16_t slack_ms,
+					      const struct sid_timespec *when,
+					      const struct sid_timespec *period)
 {
 	if (!timer_storage || !when) {
 		return SID_ERROR_INVALID_ARGS;
@@ -188,17 +352,47 @@ sid_error_t sid_pal_timer_arm(sid_pal_timer_t *timer_storage, sid_pal_timer_prio
 	if (sid_pal_timer_is_armed(timer_storage)) {
 		return SID_ERROR_INVALID_ARGS;
 	}
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED
+	/* An expired one-shot timer may still wait for the worker, drop the old callback */
+	sid_timer_ready_cancel(timer_storage);
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED */
 	if (!period) {
 		period = &SID_TIME_INFINITY;
 	}
 
 	timer_storage->alarm = *when;
 	timer_storage->period = *period;
-	timer_storage->tolerance = sid_pal_timer_get_tolerance(type);
-	sid_pal_timer_list_insert(&sid_pal_timer_ctx, timer_storage);
+	timer_storage->slack_ms = slack_ms;
+	sid_pal_timer_list_insert(timer_storage);
 	return SID_ERROR_NONE;
 }
 
+sid_error_t sid_pal_timer_arm(sid_pal_timer_t *timer_storage, sid_pal_timer_prio_class_t type,
+			      const struct sid_timespec *when, const struct sid_timespec *period)
+{
+	return sid_pal_timer_arm_internal(timer_storage, sid_pal_timer_get_slack_ms(type), when,
+					  period);
+}
+
+sid_error_t sid_pal_timer_arm_with_slack(sid_pal_timer_t *timer_storage,
+					 const struct sid_timespec *when,
+					 const struct sid_timespec *period,
+					 const struct sid_timespec *slack)
+{
+	uint64_t slack_ms = 0;
+
+	if (slack) {
+		if (slack->tv_nsec >= NSEC_PER_SEC) {
+			return SID_ERROR_INVALID_ARGS;
+		}
+		slack_ms = (uint64_t)slack->tv_sec * MSEC_PER_SEC + slack->tv_nsec / NSEC_PER_MSEC;
+	}
+
+	return sid_pal_timer_arm_internal(timer_storage,
+					  (uint16_t)MIN(slack_ms, SID_PAL_TIMER_SLACK_MS_MAX), when,
+					  period);
+}
+
 sid_error_t sid_pal_timer_cancel(sid_pal_timer_t *timer_storage)
 {
 	if (!timer_storage) {
@@ -223,15 +417,16 @@ void sid_pal_timer_event_callback(void *arg, const struct sid_timespec *now)
 	ARG_UNUSED(arg);
 	sid_pal_timer_t *timer = NULL;
 
+	TIMER_STATS_INC(wakeups);
 	do {
-		sid_pal_timer_list_fetch(&sid_pal_timer_ctx, now, &timer);
+		sid_pal_timer_list_fetch(now, &timer);
 		if (!timer) {
 			break;
 		}
 		if (!sid_time_is_infinity(&timer->period)) {
 			sid_time_add(&timer->alarm, &timer->period);
 
-			sid_pal_timer_list_insert(&sid_pal_timer_ctx, timer);
+			sid_pal_timer_list_insert(timer);
 		}
 		if (timer->callback) {
 			timer->callback(timer->callback_arg, (sid_pal_timer_t *)timer);
@@ -240,32 +435,113 @@ void sid_pal_timer_event_callback(void *arg, const struct sid_timespec *now)
 
 	struct sid_timespec next_schedule;
 
-	sid_pal_timer_list_get_next_schedule(&sid_pal_timer_ctx, &next_schedule);
+	sid_pal_timer_list_get_next_schedule(&next_schedule);
 	sid_timer_start(&next_schedule);
 }
 
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED
+/*
+ * Move all expired timers to the ready ring in one critical section and program the next
+ * expiry. Returns false if the ring is full and expired timers are left in the queue.
+ */
+static bool sid_timer_collect(const struct sid_timespec *now)
+{
+	sid_pal_timer_t *timer;
+	bool collected = true;
+
+	sid_pal_enter_critical_region();
+	while ((timer = sid_timer_queue_peek()) && sid_pal_timer_is_due(timer, now)) {
+		if (!sid_timer_ready_push(timer)) {
+			collected = false;
+			break;
+		}
+		sid_pal_timer_expire(timer, now);
+		if (!sid_time_is_infinity(&timer->period)) {
+			sid_time_add(&timer->alarm, &timer->period);
+
+			sid_pal_timer_list_insert(timer);
+		}
+	}
+	if (collected) {
+		sid_timer_start(timer ? &timer->alarm : &SID_TIME_INFINITY);
+	}
+	sid_pal_exit_critical_region();
+
+	return collected;
+}
+
+void sid_timer_dispatch_ready(void)
+{
+	sid_pal_timer_t *timer;
+	uint32_t fire_cycles;
+
+	do {
+		while ((timer = sid_timer_ready_pop(&fire_cycles))) {
+#ifdef CONFIG_SIDEWALK_TIMER_LATENCY_STATS
+			const uint32_t delay_us =
+				k_cyc_to_us_floor32(k_cycle_get_32() - fire_cycles);
+
+			sid_timer_latency_record(latency_stats.dispatch_delay,
+						 &latency_stats.dispatch_delay_max_us, delay_us);
+#endif /* CONFIG_SIDEWALK_TIMER_LATENCY_STATS */
+			if (timer->callback) {
+				timer->callback(timer->callback_arg, timer);
+			}
+		}
+		if (!atomic_clear(&ready_overflow)) {
+			break;
+		}
+
+		struct sid_timespec now;
+
+		sid_pal_uptime_now(&now);
+		if (!sid_timer_collect(&now)) {
+			atomic_set(&ready_overflow, 1);
+		}
+	} while (1);
+}
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED */
+
 static void sid_timer_handler(struct k_timer *timer_data)
 {
 	ARG_UNUSED(timer_data);
-#ifndef CONFIG_SIDEWALK_THREAD_TIMER
+#if defined(CONFIG_SIDEWALK_TIMER_DEFERRED)
+	struct sid_timespec handle_time;
+	sid_pal_uptime_now(&handle_time);
+	TIMER_STATS_INC(wakeups);
+	if (!sid_timer_collect(&handle_time)) {
+		atomic_set(&ready_overflow, 1);
+	}
+#if defined(CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI)
+	sid_pal_swi_timer_notify();
+#else
+	k_sem_give(&timer_trigger_sem);
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED_WORKER_SWI */
+#elif !defined(CONFIG_SIDEWALK_THREAD_TIMER)
 	struct sid_timespec handle_time;
 	sid_pal_uptime_now(&handle_time);
 	sid_pal_timer_event_callback(NULL, &handle_time);
 #else
 	k_sem_give(&timer_trigger_sem);
-#endif /* CONFIG_SIDEWALK_THREAD_TIMER */
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED */
 }
 
 K_TIMER_DEFINE(sid_timer, sid_timer_handler, NULL);
 
 static void sid_timer_start(const struct sid_timespec *sid_time)
 {
+	struct sid_timespec kernel_time = *sid_time;
 	k_ticks_t timer_duration;
 
-	timer_duration = (k_ticks_t)k_ns_to_ticks_ceil64(MAX((uint64_t)sid_time->tv_nsec, 0));
-	timer_duration +=
-		(k_ticks_t)k_ms_to_ticks_ceil64(MAX((uint64_t)sid_time->tv_sec * MSEC_PER_SEC, 0));
+	if (!sid_time_is_infinity(sid_time)) {
+		sid_uptime_to_kernel(sid_time, &kernel_time);
+	}
+
+	timer_duration = (k_ticks_t)k_ns_to_ticks_ceil64(MAX((uint64_t)kernel_time.tv_nsec, 0));
+	timer_duration += (k_ticks_t)k_ms_to_ticks_ceil64(
+		MAX((uint64_t)kernel_time.tv_sec * MSEC_PER_SEC, 0));
 	k_timer_start(&sid_timer, Z_TIMEOUT_TICKS(Z_TICK_ABS(timer_duration)), K_NO_WAIT);
+	TIMER_STATS_INC(reprograms);
 }
 
 #ifdef CONFIG_SIDEWALK_THREAD_TIMER
@@ -277,12 +553,52 @@ static void timer_task(void *arg1, void *arg2, void *arg3)
 
 	while (1) {
 		k_sem_take(&timer_trigger_sem, K_FOREVER);
+#ifdef CONFIG_SIDEWALK_TIMER_DEFERRED
+		sid_timer_dispatch_ready();
+#else
 		struct sid_timespec handle_time;
 		sid_pal_uptime_now(&handle_time);
 		sid_pal_timer_event_callback(NULL, &handle_time);
+#endif /* CONFIG_SIDEWALK_TIMER_DEFERRED */
 	}
 }
 
 K_THREAD_DEFINE(timer_thread, CONFIG_SIDEWALK_TIMER_STACK_SIZE, timer_task, NULL, NULL, NULL,
 		K_PRIO_COOP(CONFIG_SIDEWALK_TIMER_PRIORITY), 0, 0);
 #endif /* CONFIG_SIDEWALK_THREAD_TIMER */
+
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+void sid_timer_stats_get(struct sid_timer_stats *stats)
+{
+	SID_PAL_ASSERT(stats);
+
+	sid_pal_enter_critical_region();
+	*stats = timer_stats;
+	sid_pal_exit_critical_region();
+}
+
+void sid_timer_stats_reset(void)
+{
+	sid_pal_enter_critical_region();
+	timer_stats = (struct sid_timer_stats){ 0 };
+	sid_pal_exit_critical_region();
+}
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+
+#ifdef CONFIG_SIDEWALK_TIMER_LATENCY_STATS
+void sid_timer_latency_stats_get(struct sid_timer_latency_stats *stats)
+{
+	SID_PAL_ASSERT(stats);
+
+	sid_pal_enter_critical_region();
+	*stats = latency_stats;
+	sid_pal_exit_critical_region();
+}
+
+void sid_timer_latency_stats_reset(void)
+{
+	sid_pal_enter_critical_region();
+	latency_stats = (struct sid_timer_latency_stats){ 0 };
+	sid_pal_exit_critical_region();
+}
+#endif /* CONFIG_SIDEWALK_TIMER_LATENCY_STATS */
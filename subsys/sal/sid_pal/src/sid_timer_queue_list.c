@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_timer_queue_list.c
+ *  @brief Timer queue backed by a sorted double linked list.
+ */
+
+#include <sid_timer_queue.h>
+#include <sid_time_ops.h>
+#include <zephyr/kernel.h>
+
+static sys_dlist_t timer_list = SYS_DLIST_STATIC_INIT(&timer_list);
+
+/* Timers with equal alarms are ordered by the earliest time they may expire */
+static bool timer_before(const sid_pal_timer_t *a, const sid_pal_timer_t *b)
+{
+	if (sid_time_gt(&b->alarm, &a->alarm)) {
+		return true;
+	}
+	if (sid_time_gt(&a->alarm, &b->alarm)) {
+		return false;
+	}
+
+	return a->deferred_ms > b->deferred_ms;
+}
+
+void sid_timer_queue_insert(sid_pal_timer_t *timer)
+{
+	sys_dnode_t *node = sys_dlist_peek_head(&timer_list);
+
+	while (node) {
+		sid_pal_timer_t *element = CONTAINER_OF(node, __typeof__(*element), node);
+		if (timer_before(timer, element)) {
+			sys_dlist_insert(&element->node, &timer->node);
+			return;
+		}
+		node = sys_dlist_peek_next_no_check(&timer_list, node);
+	}
+
+	sys_dlist_append(&timer_list, &timer->node);
+}
+
+void sid_timer_queue_remove(sid_pal_timer_t *timer)
+{
+	if (sys_dnode_is_linked(&timer->node)) {
+		sys_dlist_remove(&timer->node);
+	}
+}
+
+bool sid_timer_queue_contains(const sid_pal_timer_t *timer)
+{
+	return sys_dnode_is_linked(&timer->node);
+}
+
+sid_pal_timer_t *sid_timer_queue_peek(void)
+{
+	sid_pal_timer_t *result = SYS_DLIST_PEEK_HEAD_CONTAINER(&timer_list, result, node);
+
+	return result;
+}
+
+sid_pal_timer_t *sid_timer_queue_find_later(const struct sid_timespec *alarm)
+{
+	sid_pal_timer_t *element;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&timer_list, element, node) {
+		if (sid_time_gt(&element->alarm, alarm)) {
+			return element;
+		}
+	}
+
+	return NULL;
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_timer_queue_rbtree.c
+ *  @brief Timer queue backed by a red-black tree.
+ *
+ *  Arm, cancel and lookup are O(log n). The tree reuses the two pointers of the timer
+ *  queue linkage, so the size of sid_pal_timer_t does not change. Timers with equal alarms
+ *  are ordered by the earliest time they may expire, then by insertion order, as in the
+ *  list backend. Every timer has a unique key: a new timer gets the sequence number after
+ *  the last queued timer with the same alarm and deferral, and the timer address breaks the
+ *  tie once the sequence number saturates.
+ */
+
+#include <sid_timer_queue.h>
+#include <sid_time_ops.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/rb.h>
+
+static bool timer_lessthan(struct rbnode *a, struct rbnode *b);
+
+static struct rbtree timer_tree = {
+	.lessthan_fn = timer_lessthan,
+};
+
+/* Cached leftmost node, peek is called after every queue modification */
+static sid_pal_timer_t *timer_first;
+
+/* The left child pointer carries the node color in bit 0 */
+static struct rbnode *timer_node_child(const struct rbnode *node, uint8_t side)
+{
+	if (side) {
+		return node->children[1];
+	}
+
+	return (struct rbnode *)((uintptr_t)node->children[0] & ~(uintptr_t)1U);
+}
+
+static int timer_key_cmp(const sid_pal_timer_t *timer_a, const sid_pal_timer_t *timer_b)
+{
+	if (sid_time_gt(&timer_b->alarm, &timer_a->alarm)) {
+		return -1;
+	}
+	if (sid_time_gt(&timer_a->alarm, &timer_b->alarm)) {
+		return 1;
+	}
+	if (timer_a->deferred_ms != timer_b->deferred_ms) {
+		return (timer_a->deferred_ms > timer_b->deferred_ms) ? -1 : 1;
+	}
+
+	return 0;
+}
+
+static int timer_cmp(const sid_pal_timer_t *timer_a, const sid_pal_timer_t *timer_b)
+{
+	int cmp = timer_key_cmp(timer_a, timer_b);
+
+	if (cmp) {
+		return cmp;
+	}
+	if (timer_a->seq != timer_b->seq) {
+		return (timer_a->seq < timer_b->seq) ? -1 : 1;
+	}
+	if (timer_a != timer_b) {
+		return ((uintptr_t)timer_a < (uintptr_t)timer_b) ? -1 : 1;
+	}
+
+	return 0;
+}
+
+static bool timer_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return timer_cmp(CONTAINER_OF(a, sid_pal_timer_t, rb_node),
+			 CONTAINER_OF(b, sid_pal_timer_t, rb_node)) < 0;
+}
+
+/* Last queued timer with the key of the given one, it has the highest sequence number */
+static sid_pal_timer_t *timer_find_last_equal(const sid_pal_timer_t *timer)
+{
+	struct rbnode *node = timer_tree.root;
+	sid_pal_timer_t *result = NULL;
+
+	while (node) {
+		sid_pal_timer_t *element = CONTAINER_OF(node, sid_pal_timer_t, rb_node);
+		int cmp = timer_key_cmp(element, timer);
+
+		if (cmp > 0) {
+			node = timer_node_child(node, 0U);
+		} else {
+			if (!cmp) {
+				result = element;
+			}
+			node = timer_node_child(node, 1U);
+		}
+	}
+
+	return result;
+}
+
+void sid_timer_queue_insert(sid_pal_timer_t *timer)
+{
+	const sid_pal_timer_t *last = timer_find_last_equal(timer);
+
+	timer->seq = last ? MIN(last->seq + 1U, SID_PAL_TIMER_SEQ_MAX) : 0U;
+	rb_insert(&timer_tree, &timer->rb_node);
+
+	if (!timer_first || timer_lessthan(&timer->rb_node, &timer_first->rb_node)) {
+		timer_first = timer;
+	}
+}
+
+void sid_timer_queue_remove(sid_pal_timer_t *timer)
+{
+	if (!sid_timer_queue_contains(timer)) {
+		return;
+	}
+
+	rb_remove(&timer_tree, &timer->rb_node);
+
+	if (timer == timer_first) {
+		struct rbnode *first = rb_get_min(&timer_tree);
+
+		timer_first = first ? CONTAINER_OF(first, sid_pal_timer_t, rb_node) : NULL;
+	}
+}
+
+bool sid_timer_queue_contains(const sid_pal_timer_t *timer)
+{
+	struct rbnode *node = timer_tree.root;
+
+	while (node) {
+		const sid_pal_timer_t *element = CONTAINER_OF(node, sid_pal_timer_t, rb_node);
+		int cmp = timer_cmp(timer, element);
+
+		if (!cmp) {
+			return true;
+		}
+		node = timer_node_child(node, (cmp < 0) ? 0U : 1U);
+	}
+
+	return false;
+}
+
+sid_pal_timer_t *sid_timer_queue_peek(void)
+{
+	return timer_first;
+}
+
+sid_pal_timer_t *sid_timer_queue_find_later(const struct sid_timespec *alarm)
+{
+	struct rbnode *node = timer_tree.root;
+	sid_pal_timer_t *result = NULL;
+
+	while (node) {
+		sid_pal_timer_t *element = CONTAINER_OF(node, sid_pal_timer_t, rb_node);
+
+		if (sid_time_gt(&element->alarm, alarm)) {
+			result = element;
+			node = timer_node_child(node, 0U);
+		} else {
+			node = timer_node_child(node, 1U);
+		}
+	}
+
+	return result;
+}
@@ -6,12 +6,19 @@
 
 /** @file sid_uptime.c
  *  @brief Uptime interface implementation.
+ *
+ *  Sidewalk uptime is the kernel uptime corrected by the crystal offset. The offset is applied
+ *  from the moment it is set, so the uptime stays continuous and monotonic. The correction is
+ *  done in integer math with parts per billion resolution.
  */
 
 #include <sid_pal_uptime_ifc.h>
+#include <sid_pal_critical_region_ifc.h>
+#include <sid_uptime_ext.h>
 #include <zephyr_time.h>
 
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(sid_uptime, CONFIG_SIDEWALK_LOG_LEVEL);
@@ -22,13 +29,92 @@ LOG_MODULE_REGISTER(sid_uptime, CONFIG_SIDEWALK_LOG_LEVEL);
 #define TIMER_RTC_MAX_PPM_TO_COMPENSATE 500
 #endif
 
+#define NSEC_PER_SEC_U64 ((uint64_t)NSEC_PER_SEC)
+#define PPB_PER_PPM 1000
+/* Weight of a new drift measurement is 1 / 2^DRIFT_FILTER_SHIFT */
+#define DRIFT_FILTER_SHIFT 2
+
+static struct {
+	/* Kernel uptime when the offset was last changed */
+	uint64_t base_kernel_ns;
+	/* Sidewalk uptime at base_kernel_ns */
+	uint64_t base_ns;
+	/* Crystal offset, positive when the crystal runs fast */
+	int32_t offset_ppb;
+	bool compensated;
+} uptime_ctx;
+
+#ifdef CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING
+static struct {
+	uint64_t kernel_ns;
+	uint64_t reference_ns;
+	bool valid;
+} sync_sample;
+#endif /* CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING */
+
+/* Nanoseconds of Sidewalk uptime per second of kernel uptime */
+static uint64_t sid_uptime_rate(void)
+{
+	return (uint64_t)((int64_t)NSEC_PER_SEC_U64 - uptime_ctx.offset_ppb);
+}
+
+/* Called in the critical region */
+static uint64_t sid_uptime_from_kernel_ns(uint64_t kernel_ns)
+{
+	const uint64_t rate = sid_uptime_rate();
+
+	if (kernel_ns <= uptime_ctx.base_kernel_ns) {
+		return uptime_ctx.base_ns;
+	}
+
+	const uint64_t elapsed = kernel_ns - uptime_ctx.base_kernel_ns;
+
+	/* floor(elapsed * rate / 1 s), seconds scaled separately to avoid overflow */
+	return uptime_ctx.base_ns + (elapsed / NSEC_PER_SEC_U64) * rate +
+	       (elapsed % NSEC_PER_SEC_U64) * rate / NSEC_PER_SEC_U64;
+}
+
+/* Called in the critical region */
+static uint64_t sid_uptime_to_kernel_ns(uint64_t uptime_ns)
+{
+	const uint64_t rate = sid_uptime_rate();
+
+	if (uptime_ns <= uptime_ctx.base_ns) {
+		return uptime_ctx.base_kernel_ns;
+	}
+
+	const uint64_t elapsed = uptime_ns - uptime_ctx.base_ns;
+	const uint64_t sec_scaled = NSEC_PER_SEC_U64 * NSEC_PER_SEC_U64 / rate;
+	const uint64_t sec_remainder = NSEC_PER_SEC_U64 * NSEC_PER_SEC_U64 % rate;
+	const uint64_t sec = elapsed / NSEC_PER_SEC_U64;
+
+	/* ceil(elapsed * 1 s / rate), the kernel timeout must not expire early */
+	return uptime_ctx.base_kernel_ns + sec * sec_scaled +
+	       DIV_ROUND_UP(sec * sec_remainder + (elapsed % NSEC_PER_SEC_U64) * NSEC_PER_SEC_U64,
+			    rate);
+}
+
+static void sid_uptime_set_offset_ppb(int32_t offset_ppb)
+{
+	sid_pal_enter_critical_region();
+	const uint64_t kernel_ns = zephyr_uptime_ns();
+
+	uptime_ctx.base_ns = sid_uptime_from_kernel_ns(kernel_ns);
+	uptime_ctx.base_kernel_ns = kernel_ns;
+	uptime_ctx.offset_ppb = offset_ppb;
+	uptime_ctx.compensated = true;
+	sid_pal_exit_critical_region();
+}
+
 sid_error_t sid_pal_uptime_now(struct sid_timespec *result)
 {
 	if (!result) {
 		return SID_ERROR_NULL_POINTER;
 	}
 
-	uint64_t uptime_ns = zephyr_uptime_ns();
+	sid_pal_enter_critical_region();
+	uint64_t uptime_ns = sid_uptime_from_kernel_ns(zephyr_uptime_ns());
+	sid_pal_exit_critical_region();
 
 	result->tv_sec = (sid_time_t)(uptime_ns / NSEC_PER_SEC);
 	result->tv_nsec = (uint32_t)(uptime_ns - ((uint64_t)result->tv_sec * NSEC_PER_SEC));
@@ -38,10 +124,83 @@ sid_error_t sid_pal_uptime_now(struct sid_timespec *result)
 
 void sid_pal_uptime_set_xtal_ppm(int16_t ppm)
 {
-	LOG_WRN("%s - not implemented.", __func__);
+	if (ppm > TIMER_RTC_MAX_PPM_TO_COMPENSATE || ppm < -TIMER_RTC_MAX_PPM_TO_COMPENSATE) {
+		LOG_WRN("Crystal offset %d ppm out of range, ignored", ppm);
+		return;
+	}
+
+	sid_uptime_set_offset_ppb((int32_t)ppm * PPB_PER_PPM);
 }
 
 int16_t sid_pal_uptime_get_xtal_ppm(void)
 {
+	if (uptime_ctx.compensated) {
+		return MIN(CONFIG_SIDEWALK_UPTIME_COMPENSATED_PPM, TIMER_RTC_MAX_PPM_TO_COMPENSATE);
+	}
+
 	return TIMER_RTC_MAX_PPM_TO_COMPENSATE;
 }
+
+void sid_uptime_to_kernel(const struct sid_timespec *uptime, struct sid_timespec *kernel)
+{
+	const uint64_t uptime_ns = (uint64_t)uptime->tv_sec * NSEC_PER_SEC + uptime->tv_nsec;
+
+	sid_pal_enter_critical_region();
+	const uint64_t kernel_ns = sid_uptime_to_kernel_ns(uptime_ns);
+	sid_pal_exit_critical_region();
+
+	kernel->tv_sec = (sid_time_t)(kernel_ns / NSEC_PER_SEC);
+	kernel->tv_nsec = (uint32_t)(kernel_ns - ((uint64_t)kernel->tv_sec * NSEC_PER_SEC));
+}
+
+#ifdef CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING
+static void sid_uptime_learn_drift(uint64_t kernel_elapsed, uint64_t reference_elapsed)
+{
+	const int64_t reference_elapsed_ms = (int64_t)(reference_elapsed / NSEC_PER_MSEC);
+
+	if (reference_elapsed_ms == 0) {
+		return;
+	}
+
+	const int64_t error_ns = (int64_t)kernel_elapsed - (int64_t)reference_elapsed;
+	const int64_t max_error_ns =
+		(int64_t)(reference_elapsed / USEC_PER_SEC) * TIMER_RTC_MAX_PPM_TO_COMPENSATE;
+
+	if (error_ns > max_error_ns || error_ns < -max_error_ns) {
+		LOG_WRN("Measured drift out of range, ignored");
+		return;
+	}
+
+	int32_t offset_ppb = (int32_t)(error_ns * MSEC_PER_SEC / reference_elapsed_ms);
+
+	if (uptime_ctx.compensated) {
+		offset_ppb = uptime_ctx.offset_ppb +
+			     (offset_ppb - uptime_ctx.offset_ppb) / (1 << DRIFT_FILTER_SHIFT);
+	}
+	sid_uptime_set_offset_ppb(offset_ppb);
+	LOG_DBG("Crystal offset %d ppb", offset_ppb);
+}
+
+void sid_uptime_sync(const struct sid_timespec *reference)
+{
+	const uint64_t reference_ns = (uint64_t)reference->tv_sec * NSEC_PER_SEC +
+				      reference->tv_nsec;
+	const uint64_t kernel_ns = zephyr_uptime_ns();
+
+	if (sync_sample.valid && reference_ns > sync_sample.reference_ns &&
+	    kernel_ns > sync_sample.kernel_ns) {
+		const uint64_t reference_elapsed = reference_ns - sync_sample.reference_ns;
+
+		if (reference_elapsed <
+		    (uint64_t)CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING_MIN_INTERVAL * NSEC_PER_SEC) {
+			/* Keep the older sample, a longer interval gives a better estimate */
+			return;
+		}
+		sid_uptime_learn_drift(kernel_ns - sync_sample.kernel_ns, reference_elapsed);
+	}
+
+	sync_sample.kernel_ns = kernel_ns;
+	sync_sample.reference_ns = reference_ns;
+	sync_sample.valid = true;
+}
+#endif /* CONFIG_SIDEWALK_UPTIME_DRIFT_LEARNING */
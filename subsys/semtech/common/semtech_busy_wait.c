@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file semtech_busy_wait.c
+ *  @brief Wait for the BUSY line of Semtech radios.
+ *
+ *  Short waits are polled, because sleeping costs more than the wait itself. Commands
+ *  whose average wait is longer than the polling limit sleep on the BUSY interrupt
+ *  right away.
+ */
+
+#include <semtech_busy_wait.h>
+#include <sid_pal_critical_region_ifc.h>
+#include <sid_pal_gpio_ifc.h>
+#include <sid_gpio_utils.h>
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#if defined(CONFIG_SIDEWALK_SUBGHZ_BUSY_IRQ) || defined(CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS)
+#define BUSY_TRACK_OPCODES 1
+#endif
+
+#ifdef BUSY_TRACK_OPCODES
+/* Weight of a new wait in the average is 1 / 2^BUSY_AVG_SHIFT */
+#define BUSY_AVG_SHIFT 2
+
+struct busy_opcode {
+	uint16_t opcode;
+	bool used;
+	/* Set after the first wait, avg_us is valid then */
+	bool learned;
+	uint32_t avg_us;
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+	uint32_t count;
+	uint32_t blocked;
+	uint32_t max_us;
+	uint64_t total_us;
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS */
+};
+
+static struct busy_opcode busy_opcodes[CONFIG_SIDEWALK_SUBGHZ_BUSY_OPCODES];
+
+static struct busy_opcode *busy_opcode_get(uint16_t opcode)
+{
+	struct busy_opcode *entry = NULL;
+
+	/* Waits from different contexts must not claim the same free slot */
+	sid_pal_enter_critical_region();
+	for (size_t i = 0; i < ARRAY_SIZE(busy_opcodes); i++) {
+		if (!busy_opcodes[i].used) {
+			busy_opcodes[i] = (struct busy_opcode){ .opcode = opcode, .used = true };
+			entry = &busy_opcodes[i];
+			break;
+		}
+		if (busy_opcodes[i].opcode == opcode) {
+			entry = &busy_opcodes[i];
+			break;
+		}
+	}
+	sid_pal_exit_critical_region();
+
+	return entry;
+}
+
+static void busy_opcode_record(struct busy_opcode *entry, uint32_t waited_us, bool blocked)
+{
+	if (!entry) {
+		return;
+	}
+
+	sid_pal_enter_critical_region();
+	if (entry->learned) {
+		const int32_t delta = (int32_t)(waited_us - entry->avg_us);
+
+		entry->avg_us = (uint32_t)((int32_t)entry->avg_us + (delta >> BUSY_AVG_SHIFT));
+	} else {
+		entry->avg_us = waited_us;
+		entry->learned = true;
+	}
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+	entry->count++;
+	entry->blocked += blocked;
+	entry->max_us = MAX(entry->max_us, waited_us);
+	entry->total_us += waited_us;
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS */
+	sid_pal_exit_critical_region();
+}
+#endif /* BUSY_TRACK_OPCODES */
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_IRQ
+static uint32_t busy_poll_time_us(const struct busy_opcode *entry)
+{
+	if (!entry || !entry->learned) {
+		return CONFIG_SIDEWALK_SUBGHZ_BUSY_POLL_MAX_US;
+	}
+	if (entry->avg_us > CONFIG_SIDEWALK_SUBGHZ_BUSY_POLL_MAX_US) {
+		return 0;
+	}
+
+	return MIN(2 * entry->avg_us, CONFIG_SIDEWALK_SUBGHZ_BUSY_POLL_MAX_US);
+}
+
+/* Sleeping is not possible in the critical region and in interrupts */
+static bool busy_can_sleep(void)
+{
+	if (k_is_in_isr() || k_is_pre_kernel()) {
+		return false;
+	}
+
+	const unsigned int key = arch_irq_lock();
+	const bool unlocked = arch_irq_unlocked(key);
+
+	arch_irq_unlock(key);
+
+	return unlocked;
+}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_IRQ */
+
+sid_error_t semtech_busy_wait(uint32_t gpio_busy, uint16_t opcode, uint32_t timeout_us)
+{
+	const uint32_t start = k_cycle_get_32();
+	sid_error_t err = SID_ERROR_BUSY;
+	bool blocked = false;
+	uint32_t waited_us;
+
+#ifdef BUSY_TRACK_OPCODES
+	struct busy_opcode *entry = busy_opcode_get(opcode);
+#else
+	ARG_UNUSED(opcode);
+#endif /* BUSY_TRACK_OPCODES */
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_IRQ
+	const uint32_t poll_us = busy_poll_time_us(entry);
+	bool can_sleep = busy_can_sleep();
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_IRQ */
+
+	while (true) {
+		uint8_t is_radio_busy = 1;
+
+		if (sid_pal_gpio_read(gpio_busy, &is_radio_busy) == SID_ERROR_NONE &&
+		    !is_radio_busy) {
+			err = SID_ERROR_NONE;
+		}
+		waited_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+		if (err == SID_ERROR_NONE || waited_us >= timeout_us) {
+			break;
+		}
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_IRQ
+		if (can_sleep && waited_us >= poll_us) {
+			int erc = sid_gpio_utils_wait_level(gpio_busy, 0,
+							    K_USEC(timeout_us - waited_us));
+
+			if (erc == 0 || erc == -EAGAIN) {
+				blocked = true;
+				err = erc ? SID_ERROR_BUSY : SID_ERROR_NONE;
+				waited_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+				break;
+			}
+			/* The pin can not be waited on, keep polling */
+			can_sleep = false;
+		}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_IRQ */
+	}
+
+#ifdef BUSY_TRACK_OPCODES
+	busy_opcode_record(entry, waited_us, blocked);
+#else
+	ARG_UNUSED(blocked);
+#endif /* BUSY_TRACK_OPCODES */
+
+	return err;
+}
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+size_t semtech_busy_stats_get(struct semtech_busy_stats *stats, size_t max_count)
+{
+	size_t count = 0;
+
+	sid_pal_enter_critical_region();
+	for (size_t i = 0; i < ARRAY_SIZE(busy_opcodes) && count < max_count; i++) {
+		if (!busy_opcodes[i].used) {
+			continue;
+		}
+		stats[count++] = (struct semtech_busy_stats){
+			.opcode = busy_opcodes[i].opcode,
+			.count = busy_opcodes[i].count,
+			.blocked = busy_opcodes[i].blocked,
+			.avg_us = busy_opcodes[i].avg_us,
+			.max_us = busy_opcodes[i].max_us,
+			.total_us = busy_opcodes[i].total_us,
+		};
+	}
+	sid_pal_exit_critical_region();
+
+	return count;
+}
+
+void semtech_busy_stats_reset(void)
+{
+	sid_pal_enter_critical_region();
+	for (size_t i = 0; i < ARRAY_SIZE(busy_opcodes); i++) {
+		/* The averages are kept, they set the polling time */
+		busy_opcodes[i].count = 0;
+		busy_opcodes[i].blocked = 0;
+		busy_opcodes[i].max_us = 0;
+		busy_opcodes[i].total_us = 0;
+	}
+	sid_pal_exit_critical_region();
+}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS */
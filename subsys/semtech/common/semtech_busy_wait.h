@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SEMTECH_BUSY_WAIT_H
+#define SEMTECH_BUSY_WAIT_H
+
+#include <sid_error.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Wait until the radio BUSY line is low.
+ *
+ * Polls the line first, then sleeps until the falling edge interrupt when called from a thread
+ * with interrupts unlocked. The polling time adapts to the waits seen after the command.
+ *
+ * @param gpio_busy - GPIO number of the BUSY line.
+ * @param opcode - command the radio is busy with, the wait is accounted to it.
+ * @param timeout_us - maximum time to wait.
+ * @return SID_ERROR_NONE when the radio is ready, SID_ERROR_BUSY on timeout.
+ */
+sid_error_t semtech_busy_wait(uint32_t gpio_busy, uint16_t opcode, uint32_t timeout_us);
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS
+struct semtech_busy_stats {
+	uint16_t opcode;
+	uint32_t count;
+	/* Waits that slept until the BUSY interrupt */
+	uint32_t blocked;
+	uint32_t avg_us;
+	uint32_t max_us;
+	uint64_t total_us;
+};
+
+/**
+ * @brief Get the BUSY wait statistics per command.
+ *
+ * @param stats - array for the statistics.
+ * @param max_count - number of elements in the array.
+ * @return number of commands written to the array.
+ */
+size_t semtech_busy_stats_get(struct semtech_busy_stats *stats, size_t max_count);
+
+/**
+ * @brief Reset the BUSY wait statistics.
+ */
+void semtech_busy_stats_reset(void);
+#endif /* CONFIG_SIDEWALK_SUBGHZ_BUSY_STATS */
+
+#endif /* SEMTECH_BUSY_WAIT_H */
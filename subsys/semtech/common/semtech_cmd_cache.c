@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file semtech_cmd_cache.c
+ *  @brief Shadow of the configuration programmed in Semtech radios.
+ *
+ *  The radio HALs ask the shadow before they send a configuration command and skip the
+ *  command when it repeats the programmed value. Only one radio driver is built, so the
+ *  statistics are read from the shadow registered last.
+ */
+
+#include <semtech_cmd_cache.h>
+#include <sid_pal_critical_region_ifc.h>
+
+#include <string.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+static struct semtech_cmd_cache *stats_cache;
+
+void semtech_cmd_cache_init(struct semtech_cmd_cache *cache)
+{
+	memset(cache, 0, sizeof(*cache));
+	stats_cache = cache;
+}
+
+bool semtech_cmd_cache_hit(struct semtech_cmd_cache *cache, size_t index, const uint8_t *params,
+			   size_t length)
+{
+	__ASSERT_NO_MSG(index < ARRAY_SIZE(cache->entries));
+
+	if (cache->entries[index].length != 0 && cache->entries[index].length == length &&
+	    memcmp(cache->entries[index].params, params, length) == 0) {
+		cache->hits++;
+		return true;
+	}
+
+	cache->misses++;
+	return false;
+}
+
+void semtech_cmd_cache_store(struct semtech_cmd_cache *cache, size_t index, const uint8_t *params,
+			     size_t length)
+{
+	__ASSERT_NO_MSG(index < ARRAY_SIZE(cache->entries));
+
+	if (length > SEMTECH_CMD_CACHE_PARAMS_MAX) {
+		cache->entries[index].length = 0;
+		return;
+	}
+
+	cache->entries[index].length = length;
+	memcpy(cache->entries[index].params, params, length);
+}
+
+void semtech_cmd_cache_invalidate(struct semtech_cmd_cache *cache)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache->entries); i++) {
+		cache->entries[i].length = 0;
+	}
+	cache->invalidations++;
+}
+
+void semtech_cmd_cache_stats_get(struct semtech_cmd_cache_stats *stats)
+{
+	*stats = (struct semtech_cmd_cache_stats){ 0 };
+	if (!stats_cache) {
+		return;
+	}
+
+	sid_pal_enter_critical_region();
+	stats->hits = stats_cache->hits;
+	stats->misses = stats_cache->misses;
+	stats->invalidations = stats_cache->invalidations;
+	sid_pal_exit_critical_region();
+}
+
+void semtech_cmd_cache_stats_reset(void)
+{
+	if (!stats_cache) {
+		return;
+	}
+
+	sid_pal_enter_critical_region();
+	stats_cache->hits = 0;
+	stats_cache->misses = 0;
+	stats_cache->invalidations = 0;
+	sid_pal_exit_critical_region();
+}
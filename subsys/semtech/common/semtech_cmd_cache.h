@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SEMTECH_CMD_CACHE_H
+#define SEMTECH_CMD_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of configuration commands a driver can shadow */
+#define SEMTECH_CMD_CACHE_ENTRIES 16
+/* Maximum parameter length of a shadowed command */
+#define SEMTECH_CMD_CACHE_PARAMS_MAX 12
+
+/**
+ * Shadow of the configuration programmed in the radio.
+ *
+ * Each driver numbers its configuration commands, like the frequency or the packet
+ * parameters, and keeps the last parameters sent for each of them. The shadow is a part of
+ * the driver context, it is only valid while the radio keeps its configuration.
+ */
+struct semtech_cmd_cache {
+	struct {
+		/* Length of params, 0 when the programmed value is unknown */
+		uint8_t length;
+		uint8_t params[SEMTECH_CMD_CACHE_PARAMS_MAX];
+	} entries[SEMTECH_CMD_CACHE_ENTRIES];
+	/* Commands not sent, because they repeated the programmed value */
+	uint32_t hits;
+	/* Commands sent */
+	uint32_t misses;
+	/* Times the shadow was cleared */
+	uint32_t invalidations;
+};
+
+struct semtech_cmd_cache_stats {
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t invalidations;
+};
+
+/**
+ * @brief Clear the shadow and use it for the statistics.
+ *
+ * @param cache - shadow in the driver context.
+ */
+void semtech_cmd_cache_init(struct semtech_cmd_cache *cache);
+
+/**
+ * @brief Check if a command would change the programmed configuration.
+ *
+ * @param cache - shadow in the driver context.
+ * @param index - number of the command in the driver.
+ * @param params - command parameters.
+ * @param length - length of the parameters.
+ * @return true if the parameters are already programmed and the command can be skipped.
+ */
+bool semtech_cmd_cache_hit(struct semtech_cmd_cache *cache, size_t index, const uint8_t *params,
+			   size_t length);
+
+/**
+ * @brief Record the parameters of a command sent to the radio.
+ *
+ * Parameters longer than SEMTECH_CMD_CACHE_PARAMS_MAX are not recorded.
+ *
+ * @param cache - shadow in the driver context.
+ * @param index - number of the command in the driver.
+ * @param params - command parameters.
+ * @param length - length of the parameters.
+ */
+void semtech_cmd_cache_store(struct semtech_cmd_cache *cache, size_t index, const uint8_t *params,
+			     size_t length);
+
+/**
+ * @brief Forget the programmed configuration.
+ *
+ * Called when the radio may lose or change its configuration, like on sleep, reset or
+ * a command error.
+ *
+ * @param cache - shadow in the driver context.
+ */
+void semtech_cmd_cache_invalidate(struct semtech_cmd_cache *cache);
+
+/**
+ * @brief Get the counters of the shadow of the radio driver.
+ *
+ * @param stats - pointer to the statistics.
+ */
+void semtech_cmd_cache_stats_get(struct semtech_cmd_cache_stats *stats);
+
+/**
+ * @brief Reset the counters of the shadow of the radio driver.
+ */
+void semtech_cmd_cache_stats_reset(void);
+
+#endif /* SEMTECH_CMD_CACHE_H */
@@ -27,6 +27,10 @@ extern "C" {
 #include <sid_pal_radio_ifc.h>
 #include <sid_pal_gpio_ifc.h>
 
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+#include <semtech_cmd_cache.h>
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
 #define LP_MAX_POWER 14
 #define LP_MIN_POWER -17
 #define HP_MAX_POWER 22
@@ -114,6 +118,11 @@ typedef struct
         sid_pal_radio_fsk_cad_params_t         fsk_cad_params;
     } settings_cache;
 
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+    /* Configuration programmed in the radio */
+    struct semtech_cmd_cache cmd_cache;
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
     struct
     {
         uint8_t  stat1;
@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "sid_pal_radio_ifc.h"
 #include "sid_pal_delay_ifc.h"
@@ -22,6 +23,8 @@
 #include "halo_lr11xx_radio.h"
 #include "lr11xx_radio.h"
 #include "lr11xx_hal.h"
+#include "semtech_busy_wait.h"
+#include "sid_serial_bus_ext.h"
 
 /*
  * -----------------------------------------------------------------------------
@@ -44,16 +47,81 @@
 
 #define SEM_TICKS_TO_WAIT   40
 
+#define LR11XX_SET_PKT_TYPE_OC 0x020E
+#define LR11XX_REBOOT_OC 0x0118
+#define LR11XX_SET_SLEEP_OC 0x011B
+#define LR11XX_CONFIG_PARAMS_MAX 12
+
 /*
  * -----------------------------------------------------------------------------
  * --- PRIVATE TYPES -----------------------------------------------------------
  */
 
+#if defined( CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE ) || defined( CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH )
+/* Configuration command, it only sets parameters and returns nothing */
+struct lr11xx_config_cmd
+{
+    uint16_t opcode;
+    uint8_t  length;
+    uint8_t  params[LR11XX_CONFIG_PARAMS_MAX];
+};
+#endif
+
 /*
  * -----------------------------------------------------------------------------
  * --- PRIVATE VARIABLES -------------------------------------------------------
  */
 
+#if defined( CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE ) || defined( CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH )
+static const struct
+{
+    uint16_t opcode;
+    /* Can wait in the batch until a command that depends on it */
+    bool deferrable;
+} config_cmds[] = {
+    { 0x0113, false }, /* SetDioIrqParams */
+    { 0x0206, true },  /* SetGfskSyncWord */
+    { 0x0208, true },  /* SetLoRaPublicNetwork */
+    { 0x020B, true },  /* SetRfFrequency */
+    { 0x020E, true },  /* SetPacketType */
+    { 0x020F, true },  /* SetModulationParams */
+    { 0x0210, true },  /* SetPacketParams */
+    { 0x0211, true },  /* SetTxParams */
+    { 0x0213, true },  /* SetRxTxFallbackMode */
+    { 0x0215, true },  /* SetPaConfig */
+    { 0x021B, true },  /* SetLoRaSyncTimeout */
+    { 0x0224, true },  /* SetGfskCrcParams */
+    { 0x0225, true },  /* SetGfskWhiteningParams */
+    { 0x022B, true },  /* SetLoRaSyncWord */
+};
+
+#define CONFIG_CMDS_NUM ( sizeof( config_cmds ) / sizeof( config_cmds[0] ) )
+#endif
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+/* The shadow in the driver context is indexed by config_cmds */
+_Static_assert( CONFIG_CMDS_NUM <= SEMTECH_CMD_CACHE_ENTRIES, "config_cmds do not fit in the shadow" );
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH
+/* Deferred configuration commands, in the order they were written */
+static struct
+{
+    struct lr11xx_config_cmd cmds[CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH_SIZE];
+    size_t                   count;
+} config_batch;
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH */
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+/* Write started by lr11xx_hal_write_async, ended by lr11xx_hal_flush */
+static struct
+{
+    bool    pending;
+    uint8_t command[2];
+    uint8_t stat[2];
+} async_write;
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
 /*
  * -----------------------------------------------------------------------------
  * --- PRIVATE FUNCTIONS DECLARATION -------------------------------------------
@@ -65,6 +133,17 @@ static sid_error_t lr11xx_wait_on_busy( const halo_drv_semtech_ctx_t* drv_ctx, u
 
 static inline bool is_scan_start_command( const uint8_t* command );
 
+static sid_error_t lr11xx_hal_flush( halo_drv_semtech_ctx_t* drv_ctx );
+
+static lr11xx_hal_status_t lr11xx_config_write( const void* context, const uint8_t* command,
+                                                const uint16_t command_length );
+
+static lr11xx_hal_status_t lr11xx_config_batch_flush( const void* context );
+
+static void lr11xx_config_cache_clear( const void* context );
+
+static bool lr11xx_is_config_cmd( const uint8_t* command, const uint16_t command_length );
+
 static lr11xx_hal_status_t lr11xx_hal_rdwr( const halo_drv_semtech_ctx_t* context, const uint8_t* command,
                                             const uint16_t command_length, uint8_t* data, const uint16_t data_length,
                                             bool read );
@@ -81,6 +160,7 @@ lr11xx_hal_status_t lr11xx_hal_abort_blocking_cmd( const void* context )
   uint8_t command[4] = { 0 };
   uint8_t unused[4] = { 0 };
 
+  (void) lr11xx_hal_flush(drv_ctx);
   int err = drv_ctx->bus_iface->xfer(drv_ctx->bus_iface, &config->bus_selector, command, unused, sizeof(command));
   if (err != SID_ERROR_NONE) {
     SL_SID_LOG_APP_ERROR("abort_blocking xfer");
@@ -102,11 +182,22 @@ lr11xx_hal_status_t lr11xx_hal_direct_read( const void* context, uint8_t* data,
     assert( drv_ctx );
     assert( data );
     assert( data_length != 0 );
-    assert( data_length <= drv_ctx->config->internal_buffer.size );
 
     const radio_lr11xx_device_config_t* config = drv_ctx->config;
-    uint8_t*                            empty  = config->internal_buffer.p;
-    memset( empty, 0, data_length );
+    /* The radio expects NOP bytes, the response overwrites them in place */
+    memset( data, 0, data_length );
+
+    /* The response belongs to the last command written, recorded ones included */
+    if( lr11xx_config_batch_flush( drv_ctx ) != LR11XX_HAL_STATUS_OK )
+    {
+        return LR11XX_HAL_STATUS_ERROR;
+    }
+
+    /* The wakeup toggles NSS, a pending write must end before it */
+    if( lr11xx_hal_flush( drv_ctx ) != SID_ERROR_NONE )
+    {
+        return LR11XX_HAL_STATUS_ERROR;
+    }
 
     if (drv_ctx->sleeping) {
       lr11xx_hal_status_t err;
@@ -123,7 +214,7 @@ lr11xx_hal_status_t lr11xx_hal_direct_read( const void* context, uint8_t* data,
         return LR11XX_HAL_STATUS_ERROR;
     }
 
-    int err = drv_ctx->bus_iface->xfer( drv_ctx->bus_iface, &config->bus_selector, empty, data, data_length );
+    int err = drv_ctx->bus_iface->xfer( drv_ctx->bus_iface, &config->bus_selector, data, data, data_length );
     if (err != SID_ERROR_NONE) {
         SL_SID_LOG_APP_ERROR(BRED"direct_read xfer fail %d"COLOR_RESET, err);
     }
@@ -150,7 +241,15 @@ lr11xx_hal_status_t lr11xx_hal_reset( const void* context )
         return LR11XX_HAL_STATUS_ERROR;
     }
 
-    const halo_drv_semtech_ctx_t* drv_ctx = ( halo_drv_semtech_ctx_t* ) context;
+    halo_drv_semtech_ctx_t* drv_ctx = ( halo_drv_semtech_ctx_t* ) context;
+
+    /* A pending write must not run into the reset */
+    ( void ) lr11xx_hal_flush( drv_ctx );
+    /* The configuration is lost, commands recorded for it too */
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH
+    config_batch.count = 0;
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH */
+    lr11xx_config_cache_clear( drv_ctx );
 
     if (!drv_ctx->config->gpios.power_cb) {
         if( sid_pal_gpio_set_direction( drv_ctx->config->gpios.power, SID_PAL_GPIO_DIRECTION_OUTPUT ) != SID_ERROR_NONE )
@@ -278,7 +377,16 @@ lr11xx_hal_status_t lr11xx_hal_read( const void* context, const uint8_t* command
         return LR11XX_HAL_STATUS_ERROR;
     }
 
+    if( lr11xx_config_batch_flush( context ) != LR11XX_HAL_STATUS_OK )
+    {
+        return LR11XX_HAL_STATUS_ERROR;
+    }
+
     ret = lr11xx_hal_rdwr( context, command, command_length, data, data_length, true );
+    if( ret != LR11XX_HAL_STATUS_OK )
+    {
+        lr11xx_config_cache_clear( context );
+    }
     return ret;
 }
 
@@ -293,7 +401,26 @@ lr11xx_hal_status_t lr11xx_hal_write( const void* context, const uint8_t* comman
         return LR11XX_HAL_STATUS_ERROR;
     }
 
+    if( data_length == 0 && lr11xx_is_config_cmd( command, command_length ) )
+    {
+        return lr11xx_config_write( context, command, command_length );
+    }
+
+    if( lr11xx_config_batch_flush( context ) != LR11XX_HAL_STATUS_OK )
+    {
+        return LR11XX_HAL_STATUS_ERROR;
+    }
+
     ret = lr11xx_hal_rdwr( context, command, command_length, ( void* ) data, data_length, false );
+
+    /* The chip may lose or change its configuration */
+    const uint16_t opcode = ( command_length >= 2 ) ? ( ( command[0] << 8 ) | command[1] ) : 0;
+    if( ret != LR11XX_HAL_STATUS_OK || opcode == LR11XX_SET_SLEEP_OC || opcode == LR11XX_REBOOT_OC ||
+        is_scan_start_command( command ) )
+    {
+        lr11xx_config_cache_clear( context );
+    }
+
     if (ret == LR11XX_HAL_STATUS_OK && is_scan_start_command(command)) {
       const halo_drv_semtech_ctx_t *cctx = context;
       if (cctx->radio_state != SID_PAL_RADIO_SCAN) {
@@ -313,25 +440,201 @@ static sid_error_t lr11xx_wait_on_busy( const halo_drv_semtech_ctx_t* drv_ctx, u
 {
     assert( drv_ctx );
 
-    uint8_t     is_radio_busy = 0;
-    uint32_t    cnt           = 0;
-    sid_error_t err           = SID_ERROR_NONE;
+    /* BUSY follows the last command only after its write has ended */
+    sid_error_t err = lr11xx_hal_flush( ( halo_drv_semtech_ctx_t* ) drv_ctx );
+    if( err != SID_ERROR_NONE )
+    {
+        return err;
+    }
+
+    /* max_wait_us counts polling steps of SEMTECH_STDBY_STATE_DELAY_US, keep the same timeout */
+    return semtech_busy_wait( drv_ctx->config->gpios.radio_busy, drv_ctx->last.command,
+                              max_wait_us * SEMTECH_STDBY_STATE_DELAY_US );
+}
+
+#if defined( CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE ) || defined( CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH )
+static int lr11xx_config_cmd_index( const uint8_t* command, const uint16_t command_length )
+{
+    if( command_length < 2 || command_length - 2 > LR11XX_CONFIG_PARAMS_MAX )
+    {
+        return -1;
+    }
 
-    while( cnt++ < max_wait_us )
+    const uint16_t opcode = ( command[0] << 8 ) | command[1];
+    for( size_t i = 0; i < CONFIG_CMDS_NUM; i++ )
     {
-        err = sid_pal_gpio_read( drv_ctx->config->gpios.radio_busy, &is_radio_busy );
-        if( ( err == SID_ERROR_NONE ) && !is_radio_busy )
+        if( config_cmds[i].opcode == opcode )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+#endif
+
+static bool lr11xx_is_config_cmd( const uint8_t* command, const uint16_t command_length )
+{
+#if defined( CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE ) || defined( CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH )
+    return lr11xx_config_cmd_index( command, command_length ) >= 0;
+#else
+    ( void ) command;
+    ( void ) command_length;
+    return false;
+#endif
+}
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+static void lr11xx_config_cache_clear( const void* context )
+{
+    semtech_cmd_cache_invalidate( &( ( halo_drv_semtech_ctx_t* ) context )->cmd_cache );
+}
+
+static bool lr11xx_config_cache_hit( const void* context, int index, const uint8_t* command,
+                                     const uint16_t command_length )
+{
+    return semtech_cmd_cache_hit( &( ( halo_drv_semtech_ctx_t* ) context )->cmd_cache, index, &command[2],
+                                  command_length - 2 );
+}
+
+static void lr11xx_config_cache_store( const void* context, int index, const uint8_t* command,
+                                       const uint16_t command_length )
+{
+    /* Parameters set for the previous packet type no longer apply */
+    if( config_cmds[index].opcode == LR11XX_SET_PKT_TYPE_OC )
+    {
+        lr11xx_config_cache_clear( context );
+    }
+    semtech_cmd_cache_store( &( ( halo_drv_semtech_ctx_t* ) context )->cmd_cache, index, &command[2],
+                             command_length - 2 );
+}
+#else
+static void lr11xx_config_cache_clear( const void* context )
+{
+    ( void ) context;
+}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
+/* Sends a configuration command, unless it repeats the last one of its kind */
+static lr11xx_hal_status_t lr11xx_config_send( const void* context, const uint8_t* command,
+                                               const uint16_t command_length )
+{
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+    const int index = lr11xx_config_cmd_index( command, command_length );
+
+    if( index >= 0 && lr11xx_config_cache_hit( context, index, command, command_length ) )
+    {
+        return LR11XX_HAL_STATUS_OK;
+    }
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
+    lr11xx_hal_status_t ret = lr11xx_hal_rdwr( context, command, command_length, NULL, 0, false );
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+    if( ret != LR11XX_HAL_STATUS_OK )
+    {
+        lr11xx_config_cache_clear( context );
+    }
+    else if( index >= 0 )
+    {
+        lr11xx_config_cache_store( context, index, command, command_length );
+    }
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
+    return ret;
+}
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH
+/* A later command of the same kind overrides a recorded one, unless the packet type changes in between */
+static struct lr11xx_config_cmd* lr11xx_config_batch_find( const uint16_t opcode )
+{
+    for( size_t i = config_batch.count; opcode != LR11XX_SET_PKT_TYPE_OC && i-- > 0; )
+    {
+        if( config_batch.cmds[i].opcode == LR11XX_SET_PKT_TYPE_OC )
         {
             break;
         }
-        sid_pal_delay_us( SEMTECH_STDBY_STATE_DELAY_US );
+        if( config_batch.cmds[i].opcode == opcode )
+        {
+            return &config_batch.cmds[i];
+        }
     }
 
-    if( cnt >= max_wait_us )
+    return NULL;
+}
+
+static void lr11xx_config_batch_record( const uint8_t* command, const uint16_t command_length )
+{
+    const uint16_t            opcode = ( command[0] << 8 ) | command[1];
+    struct lr11xx_config_cmd* entry  = lr11xx_config_batch_find( opcode );
+
+    /* The overridden command keeps its place, the radio needs some commands in order */
+    if( entry == NULL )
     {
-        return SID_ERROR_BUSY;
+        entry = &config_batch.cmds[config_batch.count++];
     }
-    return SID_ERROR_NONE;
+    entry->opcode = opcode;
+    entry->length = command_length - 2;
+    memcpy( entry->params, &command[2], entry->length );
+}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH */
+
+/* Sends the recorded configuration commands in order, the first error is returned */
+static lr11xx_hal_status_t lr11xx_config_batch_flush( const void* context )
+{
+    lr11xx_hal_status_t ret = LR11XX_HAL_STATUS_OK;
+
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH
+    for( size_t i = 0; i < config_batch.count; i++ )
+    {
+        const struct lr11xx_config_cmd* entry = &config_batch.cmds[i];
+        uint8_t                         command[2 + LR11XX_CONFIG_PARAMS_MAX];
+
+        command[0] = entry->opcode >> 8;
+        command[1] = entry->opcode & 0xFF;
+        memcpy( &command[2], entry->params, entry->length );
+        if( lr11xx_config_send( context, command, 2 + entry->length ) != LR11XX_HAL_STATUS_OK &&
+            ret == LR11XX_HAL_STATUS_OK )
+        {
+            SL_SID_LOG_APP_ERROR( "deferred command 0x%04X failed", entry->opcode );
+            ret = LR11XX_HAL_STATUS_ERROR;
+        }
+    }
+    config_batch.count = 0;
+#else
+    ( void ) context;
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH */
+
+    return ret;
+}
+
+static lr11xx_hal_status_t lr11xx_config_write( const void* context, const uint8_t* command,
+                                                const uint16_t command_length )
+{
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH
+    const int index = lr11xx_config_cmd_index( command, command_length );
+
+    if( index >= 0 && config_cmds[index].deferrable )
+    {
+        const uint16_t opcode = ( command[0] << 8 ) | command[1];
+
+        if( config_batch.count == CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH_SIZE &&
+            lr11xx_config_batch_find( opcode ) == NULL &&
+            lr11xx_config_batch_flush( context ) != LR11XX_HAL_STATUS_OK )
+        {
+            return LR11XX_HAL_STATUS_ERROR;
+        }
+        lr11xx_config_batch_record( command, command_length );
+        return LR11XX_HAL_STATUS_OK;
+    }
+
+    if( lr11xx_config_batch_flush( context ) != LR11XX_HAL_STATUS_OK )
+    {
+        return LR11XX_HAL_STATUS_ERROR;
+    }
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_BATCH */
+
+    return lr11xx_config_send( context, command, command_length );
 }
 
 static inline bool is_scan_start_command( const uint8_t* command )
@@ -368,6 +671,101 @@ static inline unsigned get_buf_max_usage( halo_drv_semtech_ctx_t* drv_ctx )
 }
 #endif /* BUFFER_USAGE_CHECK */
 
+/* stat1 and stat2 returned with a command report the result of the previous one */
+static lr11xx_hal_status_t lr11xx_hal_check_stat( halo_drv_semtech_ctx_t* drv_ctx, const uint8_t* command,
+                                                  const uint8_t* stat )
+{
+	lr11xx_hal_status_t ret = LR11XX_HAL_STATUS_OK;
+
+    drv_ctx->last.stat1 = stat[0];
+    if( !( drv_ctx->last.stat1 & STATUS_OK_MASK ) && drv_ctx->last.command )
+    {
+		bool ok = false;
+		if (drv_ctx->aborted) {
+			if ((drv_ctx->last.stat1 & 0x0e) == (LR11XX_SYSTEM_CMD_STATUS_CMD_ABORT << STATUS_FIELD_OFFSET_BITS)) {
+				SL_SID_LOG_APP_INFO("abort response: CMD_ABORT");
+				ok = true;
+			} else {
+				SL_SID_LOG_APP_INFO("abort response, stat1 %x", drv_ctx->last.stat1);
+			}
+			drv_ctx->aborted = false;
+		}
+		if (!ok) {
+			/* section 3.4.2: bit0 = interrupt status */
+			SL_SID_LOG_APP_WARNING( "during 0x%02X%02X, Command 0x%.4X failed; Stat1 0x%.2X int1:%d Stat2 0x%.2X ", command[0], command[1],
+							 drv_ctx->last.command, drv_ctx->last.stat1, _read_int1(drv_ctx), drv_ctx->last.stat2);
+			drv_ctx->last.failedCommand = drv_ctx->last.command;
+			ret = LR11XX_HAL_STATUS_ERROR;
+		}
+    } else if (drv_ctx->aborted) {
+		SL_SID_LOG_APP_INFO("abort response: OK");
+		drv_ctx->aborted = false;
+	}
+
+    drv_ctx->last.stat2 = stat[1];
+    drv_ctx->last.command = ( command[0] << 8 ) | command[1];
+    if (drv_ctx->last.command == 0x11b) {
+      drv_ctx->sleeping = true;
+    }
+
+    return ret;
+}
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+/* The caller buffers may be gone when the transfer ends, so the write is staged */
+static lr11xx_hal_status_t lr11xx_hal_write_async( halo_drv_semtech_ctx_t* drv_ctx, const uint8_t* command,
+                                                   const uint16_t command_length, const uint8_t* data,
+                                                   const uint16_t data_length )
+{
+    uint8_t* buff = drv_ctx->config->internal_buffer.p;
+
+    memcpy( buff, command, command_length );
+    memcpy( &buff[command_length], data, data_length );
+    memcpy( async_write.command, command, sizeof( async_write.command ) );
+
+    const struct sid_pal_serial_bus_buf bufs[] = {
+        { .tx = buff, .rx = async_write.stat, .len = sizeof( async_write.stat ) },
+        { .tx = &buff[sizeof( async_write.stat )], .len = command_length + data_length - sizeof( async_write.stat ) },
+    };
+
+    if( sid_pal_serial_bus_xfer_v_async( drv_ctx->bus_iface, &drv_ctx->config->bus_selector, bufs,
+                                         sizeof( bufs ) / sizeof( bufs[0] ), NULL, NULL ) != SID_ERROR_NONE )
+    {
+        SL_SID_LOG_APP_ERROR( "rdwr async write xfer fail" );
+        return LR11XX_HAL_STATUS_ERROR;
+    }
+    async_write.pending = true;
+
+    return LR11XX_HAL_STATUS_OK;
+}
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
+/* Ends a write started by lr11xx_hal_write_async */
+static sid_error_t lr11xx_hal_flush( halo_drv_semtech_ctx_t* drv_ctx )
+{
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+    if( !async_write.pending )
+    {
+        return SID_ERROR_NONE;
+    }
+    async_write.pending = false;
+
+    sid_error_t err = sid_pal_serial_bus_flush( drv_ctx->bus_iface );
+    if( err != SID_ERROR_NONE )
+    {
+        SL_SID_LOG_APP_ERROR( "rdwr async write xfer fail" );
+        return err;
+    }
+
+    /* The write has returned already, a failure is only logged and kept in last.failedCommand */
+    ( void ) lr11xx_hal_check_stat( drv_ctx, async_write.command, async_write.stat );
+#else
+    ( void ) drv_ctx;
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
+    return SID_ERROR_NONE;
+}
+
 static lr11xx_hal_status_t lr11xx_hal_rdwr( const halo_drv_semtech_ctx_t* context, const uint8_t* command,
                                             const uint16_t command_length, uint8_t* data, const uint16_t data_length,
                                             bool read )
@@ -404,56 +802,55 @@ static lr11xx_hal_status_t lr11xx_hal_rdwr( const halo_drv_semtech_ctx_t* contex
     }
 #endif
 
-    size_t   size = command_length;
-    uint8_t* buff = drv_ctx->config->internal_buffer.p;
-    memcpy( buff, command, command_length );
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+    if( !read && data_length >= CONFIG_SIDEWALK_SPI_BUS_ASYNC_MIN_LEN && command_length >= sizeof( async_write.stat ) &&
+        command_length + data_length <= drv_ctx->config->internal_buffer.size )
+    {
+        return lr11xx_hal_write_async( drv_ctx, command, command_length, data, data_length );
+    }
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
+    /* Command and payload are sent from the caller buffers, stat1 and stat2 come back first */
+    uint8_t                       stat[2]     = { 0 };
+    const uint16_t                stat_length = ( command_length < sizeof( stat ) ) ? command_length : sizeof( stat );
+    struct sid_pal_serial_bus_buf bufs[3];
+    size_t                        count = 0;
+
+    bufs[count++] = ( struct sid_pal_serial_bus_buf ){ .tx = command, .rx = stat, .len = stat_length };
+    if( command_length > stat_length )
+    {
+        bufs[count++] = ( struct sid_pal_serial_bus_buf ){ .tx = &command[stat_length], .len = command_length - stat_length };
+    }
     if( !read && data_length > 0 )
     {
-        size += data_length;
-        memcpy( &buff[command_length], data, data_length );
+        const uint8_t* payload = data;
+
+        /* Constant data, like a firmware image in flash, is not reachable by the SPI DMA */
+        if( !sid_pal_serial_bus_buf_in_ram( data, data_length ) )
+        {
+            if( data_length > drv_ctx->config->internal_buffer.size )
+            {
+                SL_SID_LOG_APP_ERROR( "rdwr payload %u too long", data_length );
+                return LR11XX_HAL_STATUS_ERROR;
+            }
+            memcpy( drv_ctx->config->internal_buffer.p, data, data_length );
+            payload = drv_ctx->config->internal_buffer.p;
+        }
+        bufs[count++] = ( struct sid_pal_serial_bus_buf ){ .tx = payload, .len = data_length };
     }
 
-    int err = drv_ctx->bus_iface->xfer( drv_ctx->bus_iface, &drv_ctx->config->bus_selector, buff, buff, size );
+    int err = sid_pal_serial_bus_xfer_v( drv_ctx->bus_iface, &drv_ctx->config->bus_selector, bufs, count );
     if( err != SID_ERROR_NONE )
     {
         SL_SID_LOG_APP_ERROR( "rdwr write xfer fail" );
         return LR11XX_HAL_STATUS_ERROR;
     }
 
-    drv_ctx->last.stat1 = buff[0];
-    if( !( drv_ctx->last.stat1 & STATUS_OK_MASK ) && drv_ctx->last.command )
-    {
-		bool ok = false;
-		if (drv_ctx->aborted) {
-			if ((drv_ctx->last.stat1 & 0x0e) == (LR11XX_SYSTEM_CMD_STATUS_CMD_ABORT << STATUS_FIELD_OFFSET_BITS)) {
-				SL_SID_LOG_APP_INFO("abort response: CMD_ABORT");
-				ok = true;
-			} else {
-				SL_SID_LOG_APP_INFO("abort response, stat1 %x", drv_ctx->last.stat1);
-			}
-			drv_ctx->aborted = false;
-		}
-		if (!ok) {
-			/* section 3.4.2: bit0 = interrupt status */
-			SL_SID_LOG_APP_WARNING( "during 0x%02X%02X, Command 0x%.4X failed; Stat1 0x%.2X int1:%d Stat2 0x%.2X ", command[0], command[1],
-							 drv_ctx->last.command, drv_ctx->last.stat1, _read_int1(drv_ctx), drv_ctx->last.stat2);
-			drv_ctx->last.failedCommand = drv_ctx->last.command;
-			ret = LR11XX_HAL_STATUS_ERROR;
-		}
-    } else if (drv_ctx->aborted) {
-		SL_SID_LOG_APP_INFO("abort response: OK");
-		drv_ctx->aborted = false;
-	}
-
-    drv_ctx->last.stat2 = buff[1];
-    drv_ctx->last.command = ( command[0] << 8 ) | command[1];
-    if (drv_ctx->last.command == 0x11b) {
-      drv_ctx->sleeping = true;
-    }
+    ret = lr11xx_hal_check_stat( drv_ctx, command, stat );
 
 #ifdef LOCAL_DEBUG
     SID_HAL_LOG_INFO( "Read back" );
-    SID_HAL_LOG_HEXDUMP_INFO( empty, size );
+    SID_HAL_LOG_HEXDUMP_INFO( stat, stat_length );
 #endif
 
     if( !read )
@@ -467,17 +864,25 @@ static lr11xx_hal_status_t lr11xx_hal_rdwr( const halo_drv_semtech_ctx_t* contex
         return LR11XX_HAL_STATUS_ERROR;
     }
 
-    size = data_length + 1;
-    buff = drv_ctx->config->internal_buffer.p;
-    memset( buff, 0, size );
-    err = drv_ctx->bus_iface->xfer( drv_ctx->bus_iface, &drv_ctx->config->bus_selector, buff, buff, size );
+    /* The radio expects NOP bytes, the response overwrites them in place */
+    uint8_t nop = 0;
+
+    memset( data, 0, data_length );
+    count         = 0;
+    bufs[count++] = ( struct sid_pal_serial_bus_buf ){ .tx = &nop, .rx = stat, .len = 1 };
+    if( data_length > 0 )
+    {
+        bufs[count++] = ( struct sid_pal_serial_bus_buf ){ .tx = data, .rx = data, .len = data_length };
+    }
+
+    err = sid_pal_serial_bus_xfer_v( drv_ctx->bus_iface, &drv_ctx->config->bus_selector, bufs, count );
     if( err != SID_ERROR_NONE )
     {
         SL_SID_LOG_APP_ERROR( "rdwr read xfer fail" );
         return LR11XX_HAL_STATUS_ERROR;
     }
 
-    drv_ctx->last.stat1 = buff[0];
+    drv_ctx->last.stat1 = stat[0];
     if( !( drv_ctx->last.stat1 & STATUS_OK_MASK ) && drv_ctx->last.command )
     {
         SL_SID_LOG_APP_WARNING( "Command rsp 0x%.4X failed; Stat1 0x%.2X Stat2 0x%.2X", drv_ctx->last.command, drv_ctx->last.stat1, drv_ctx->last.stat2);
@@ -485,11 +890,9 @@ static lr11xx_hal_status_t lr11xx_hal_rdwr( const halo_drv_semtech_ctx_t* contex
 
 #ifdef LOCAL_DEBUG
     SID_HAL_LOG_INFO( "Data" );
-    SID_HAL_LOG_HEXDUMP_INFO( buff, size );
+    SID_HAL_LOG_HEXDUMP_INFO( data, data_length );
 #endif
 
-    memcpy( data, &buff[1], data_length );
-
     return ret;
 }
 
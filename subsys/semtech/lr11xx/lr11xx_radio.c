@@ -1599,6 +1599,9 @@ int32_t sid_pal_radio_init( sid_pal_radio_event_notify_t notify, sid_pal_radio_i
         drv_ctx.report_radio_event = notify;
         drv_ctx.irq_handler        = dio_irq_handler;
         drv_ctx.modem              = SID_PAL_RADIO_MODEM_MODE_LORA;
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+        semtech_cmd_cache_init( &drv_ctx.cmd_cache );
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
 
         sid_pal_radio_set_region( drv_ctx.config->regional_config.radio_region );
 
@@ -20,6 +20,10 @@ extern "C" {
 #include <sid_pal_radio_ifc.h>
 #include <sid_pal_gpio_ifc.h>
 
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+#include <semtech_cmd_cache.h>
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
 #include <sx126x.h>
 #include <sx126x_hal.h>
 #include <sx126x_halo.h>
@@ -58,10 +62,16 @@ typedef struct {
     uint16_t                                     irq_mask;
     uint16_t                                     trim;
     uint32_t                                     radio_freq_hz;
+    /* Last command sent, the next BUSY wait is accounted to it */
+    uint8_t                                      last_opcode;
 
     struct {
         sid_pal_radio_fsk_cad_params_t           fsk_cad_params;
     }                                            settings_cache;
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+    /* Configuration programmed in the radio */
+    struct semtech_cmd_cache                     cmd_cache;
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
     radio_sx126x_regional_param_t                regional_radio_param;
 } halo_drv_semtech_ctx_t;
 
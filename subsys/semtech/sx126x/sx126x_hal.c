@@ -8,12 +8,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <sid_pal_delay_ifc.h>
 #include <sid_pal_critical_region_ifc.h>
 
 #include <sx126x.h>
 #include <sx126x_radio.h>
+#include <sid_serial_bus_ext.h>
 
 #ifdef MARS_SPI_BUS_WORKAROUND
 #include "board_hal.h"
@@ -25,6 +27,28 @@
 // Delay time when SX126x wakes up from sleep and goes to standby
 #define SEMTECH_SLEEP_STATE_DELAY_US       550
 
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+/* Configuration commands shadowed in the driver context, the address is for register writes */
+static const struct {
+    uint8_t  opcode;
+    uint16_t address;
+} config_cmds[] = {
+    { SX126X_SET_DIOIRQPARAMS, 0 },
+    { SX126X_SET_RFFREQUENCY, 0 },
+    { SX126X_SET_PACKETTYPE, 0 },
+    { SX126X_SET_MODULATIONPARAMS, 0 },
+    { SX126X_SET_PACKETPARAMS, 0 },
+    { SX126X_SET_TXPARAMS, 0 },
+    { SX126X_SET_PACONFIG, 0 },
+    { SX126X_SET_BUFFERBASEADDRESS, 0 },
+    { SX126X_WRITE_REGISTER, SX126X_REG_SYNCWORDBASEADDRESS },
+    { SX126X_WRITE_REGISTER, SX126X_REG_LR_SYNCWORD },
+};
+
+_Static_assert(sizeof(config_cmds) / sizeof(config_cmds[0]) <= SEMTECH_CMD_CACHE_ENTRIES,
+               "config_cmds do not fit in the shadow");
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
 static int32_t set_gpio_power(const halo_drv_semtech_ctx_t *drv_ctx,
                               sid_pal_gpio_direction_t dir)
 {
@@ -102,6 +126,62 @@ static int32_t sx126x_hal_rdwr(const void* context, const uint8_t* command, cons
     return err;
 }
 
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+static struct semtech_cmd_cache *sx126x_config_cache(const void *context)
+{
+    return &((halo_drv_semtech_ctx_t *)context)->cmd_cache;
+}
+
+/* Returns the entry of the command in config_cmds and copies its parameters, -1 for other commands */
+static int sx126x_config_cmd_index(const uint8_t *command, const uint16_t command_length,
+                                   const uint8_t *data, const uint16_t data_length,
+                                   uint8_t *params, size_t *length)
+{
+    *length = command_length - 1 + data_length;
+    if (*length > SEMTECH_CMD_CACHE_PARAMS_MAX) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < sizeof(config_cmds) / sizeof(config_cmds[0]); i++) {
+        if (config_cmds[i].opcode != command[0]) {
+            continue;
+        }
+        if (command[0] == SX126X_WRITE_REGISTER &&
+            (command_length != 3 || ((command[1] << 8) | command[2]) != config_cmds[i].address)) {
+            continue;
+        }
+        memcpy(params, &command[1], command_length - 1);
+        if (data_length > 0) {
+            memcpy(&params[command_length - 1], data, data_length);
+        }
+        return i;
+    }
+
+    return -1;
+}
+
+static void sx126x_config_cache_update(const void *context, const uint8_t *command, int index,
+                                       const uint8_t *params, size_t length, bool sent)
+{
+    struct semtech_cmd_cache *cache = sx126x_config_cache(context);
+
+    /* The radio may have lost or changed its configuration */
+    if (!sent || command[0] == SX126X_SET_SLEEP) {
+        semtech_cmd_cache_invalidate(cache);
+        return;
+    }
+    if (index < 0) {
+        return;
+    }
+
+    /* Parameters set for the previous packet type no longer apply */
+    if (command[0] == SX126X_SET_PACKETTYPE) {
+        semtech_cmd_cache_invalidate(cache);
+    }
+    semtech_cmd_cache_store(cache, index, params, length);
+}
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
 void set_gpio_cfg_awake(const halo_drv_semtech_ctx_t *drv_ctx)
 {
     /*TODO: Is this needed ? */
@@ -130,6 +210,13 @@ sx126x_hal_status_t sx126x_hal_reset(const void *ctx)
         }
 
         drv_ctx = (halo_drv_semtech_ctx_t *)ctx;
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+        /* A pending write must not run into the reset */
+        (void)sid_pal_serial_bus_flush(drv_ctx->bus_iface);
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+        semtech_cmd_cache_invalidate(sx126x_config_cache(ctx));
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
 
         sid_pal_delay_us(10*1000);
         err = RADIO_ERROR_HARDWARE_ERROR;
@@ -215,6 +302,9 @@ sx126x_hal_status_t sx126x_hal_read(const void* context, const uint8_t* command,
             break;
         }
         if (sx126x_hal_rdwr(context, command, command_length, data, data_length, true) != RADIO_ERROR_NONE) {
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+            semtech_cmd_cache_invalidate(sx126x_config_cache(context));
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
             break;
         }
         status = SX126X_STATUS_OK;
@@ -234,13 +324,31 @@ sx126x_hal_status_t sx126x_hal_write(const void* context, const uint8_t* command
             break;
         }
 
-        // If device is in sleep or rx dc state wake up
+        // If device is in sleep or rx dc state wake up, the radio expects it of a skipped command too
         const halo_drv_semtech_ctx_t *drv_ctx = (halo_drv_semtech_ctx_t *)context;
         if (sx126x_wait_for_device_ready(drv_ctx) != RADIO_ERROR_NONE) {
             break;
         }
 
-        if (sx126x_hal_rdwr(context, command, command_length, (uint8_t *)data, data_length, false) != RADIO_ERROR_NONE) {
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+        uint8_t params[SEMTECH_CMD_CACHE_PARAMS_MAX];
+        size_t params_length;
+        const int index = sx126x_config_cmd_index(command, command_length, data, data_length,
+                                                  params, &params_length);
+
+        // Skip the command if the radio is already configured so
+        if (index >= 0 && semtech_cmd_cache_hit(sx126x_config_cache(context), index, params, params_length)) {
+            status = SX126X_STATUS_OK;
+            break;
+        }
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+
+        const bool sent = sx126x_hal_rdwr(context, command, command_length, (uint8_t *)data, data_length,
+                                          false) == RADIO_ERROR_NONE;
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+        sx126x_config_cache_update(context, command, index, params, params_length, sent);
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
+        if (!sent) {
             break;
         }
         status = SX126X_STATUS_OK;
@@ -5,6 +5,8 @@
  */
 
 #include "sx126x_radio.h"
+#include "semtech_busy_wait.h"
+#include "sid_serial_bus_ext.h"
 
 #include <sid_error.h>
 
@@ -155,17 +157,6 @@ static int32_t radio_disable_irq(void)
     return RADIO_ERROR_NONE;
 }
 
-static int32_t sx126x_check_status(void)
-{
-    uint8_t is_radio_busy;
-    if (sid_pal_gpio_read(drv_ctx.config->gpio_radio_busy,
-                          &is_radio_busy) != SID_ERROR_NONE) {
-        return RADIO_ERROR_HARDWARE_ERROR;
-    }
-
-    return is_radio_busy ? RADIO_ERROR_BUSY: RADIO_ERROR_NONE;
-}
-
 static int32_t radio_set_modem_to_lora_mode(void)
 {
     if (sx126x_set_pkt_type(&drv_ctx, SX126X_PKT_TYPE_LORA) != SX126X_STATUS_OK) {
@@ -250,17 +241,18 @@ const halo_drv_semtech_ctx_t* sx126x_get_drv_ctx(void)
 
 int32_t sx126x_wait_on_busy(void)
 {
-    uint16_t cnt = 0;
-
-    while(cnt++ < SEMTECH_MAX_WAIT_ON_BUSY_CNT_US) {
-        if (sx126x_check_status() == RADIO_ERROR_NONE) {
-            break;
-        }
+    /* SEMTECH_MAX_WAIT_ON_BUSY_CNT_US counts polling steps of SEMTECH_STDBY_STATE_DELAY_US */
+    const uint32_t timeout_us = SEMTECH_MAX_WAIT_ON_BUSY_CNT_US * SEMTECH_STDBY_STATE_DELAY_US;
 
-        sid_pal_delay_us(SEMTECH_STDBY_STATE_DELAY_US);
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+    /* BUSY follows the last command only after its write has ended */
+    if (sid_pal_serial_bus_flush(drv_ctx.bus_iface) != SID_ERROR_NONE) {
+        return RADIO_ERROR_IO_ERROR;
     }
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
 
-    if (cnt >= SEMTECH_MAX_WAIT_ON_BUSY_CNT_US) {
+    if (semtech_busy_wait(drv_ctx.config->gpio_radio_busy, drv_ctx.last_opcode,
+                          timeout_us) != SID_ERROR_NONE) {
         return RADIO_ERROR_HARDWARE_ERROR;
     }
 
@@ -280,6 +272,9 @@ int32_t sx126x_radio_bus_xfer(const uint8_t *cmd_buffer, uint16_t cmd_buffer_siz
         return RADIO_ERROR_INVALID_PARAMS;
     }
 
+    const struct sid_pal_serial_bus_iface *bus_iface = drv_ctx.bus_iface;
+
+#if MARS_SPI_BUS_WORKAROUND
     if (drv_ctx.config->internal_buffer.size < (size + cmd_buffer_size)) {
         return RADIO_ERROR_NOMEM;
     }
@@ -289,15 +284,9 @@ int32_t sx126x_radio_bus_xfer(const uint8_t *cmd_buffer, uint16_t cmd_buffer_siz
         memcpy(&drv_ctx.config->internal_buffer.p[cmd_buffer_size], buffer, size);
     }
 
-    const struct sid_pal_serial_bus_iface *bus_iface = drv_ctx.bus_iface;
-
     if (bus_iface->xfer(bus_iface, &drv_ctx.config->bus_selector,
         drv_ctx.config->internal_buffer.p,
-#if MARS_SPI_BUS_WORKAROUND
         &drv_ctx.config->internal_buffer.p[read_offset? read_offset: 0],
-#else
-        drv_ctx.config->internal_buffer.p,
-#endif
         size + cmd_buffer_size) != SID_ERROR_NONE) {
         return RADIO_ERROR_IO_ERROR;
     }
@@ -305,6 +294,59 @@ int32_t sx126x_radio_bus_xfer(const uint8_t *cmd_buffer, uint16_t cmd_buffer_siz
     if (read_offset != 0 && buffer != NULL) {
         memcpy(buffer, &drv_ctx.config->internal_buffer.p[read_offset], size);
     }
+#else
+    /* Command and data are transferred in place, the response of a read lands in buffer */
+    const bool read = (read_offset != 0);
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+    /* Long writes are staged and sent while the caller goes on, sx126x_wait_on_busy ends them */
+    if (!read && buffer != NULL && size >= CONFIG_SIDEWALK_SPI_BUS_ASYNC_MIN_LEN &&
+        drv_ctx.config->internal_buffer.size >= (size + cmd_buffer_size)) {
+        uint8_t *staged = drv_ctx.config->internal_buffer.p;
+        const struct sid_pal_serial_bus_buf buf = { .tx = staged, .len = cmd_buffer_size + size };
+
+        /* A write started before still reads the staging buffer */
+        if (sid_pal_serial_bus_flush(bus_iface) != SID_ERROR_NONE) {
+            return RADIO_ERROR_IO_ERROR;
+        }
+        memcpy(staged, cmd_buffer, cmd_buffer_size);
+        memcpy(&staged[cmd_buffer_size], buffer, size);
+        if (sid_pal_serial_bus_xfer_v_async(bus_iface, &drv_ctx.config->bus_selector, &buf, 1,
+                                            NULL, NULL) != SID_ERROR_NONE) {
+            return RADIO_ERROR_IO_ERROR;
+        }
+        drv_ctx.last_opcode = cmd_buffer[0];
+
+        return RADIO_ERROR_NONE;
+    }
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
+    struct sid_pal_serial_bus_buf bufs[2] = {
+        { .tx = cmd_buffer, .len = cmd_buffer_size },
+    };
+    size_t count = 1;
+
+    if (buffer != NULL && size > 0) {
+        bufs[count++] = (struct sid_pal_serial_bus_buf){
+            .tx = buffer, .rx = read ? buffer : NULL, .len = size
+        };
+    }
+
+    /* Constant data in flash is not reachable by the SPI DMA */
+    if (!read && count > 1 && !sid_pal_serial_bus_buf_in_ram(buffer, size)) {
+        if (drv_ctx.config->internal_buffer.size < size) {
+            return RADIO_ERROR_NOMEM;
+        }
+        memcpy(drv_ctx.config->internal_buffer.p, buffer, size);
+        bufs[1].tx = drv_ctx.config->internal_buffer.p;
+    }
+
+    if (sid_pal_serial_bus_xfer_v(bus_iface, &drv_ctx.config->bus_selector, bufs,
+                                  count) != SID_ERROR_NONE) {
+        return RADIO_ERROR_IO_ERROR;
+    }
+#endif /* MARS_SPI_BUS_WORKAROUND */
+    drv_ctx.last_opcode = cmd_buffer[0];
 
     return RADIO_ERROR_NONE;
 }
@@ -1321,6 +1363,9 @@ int32_t sid_pal_radio_init(sid_pal_radio_event_notify_t notify, sid_pal_radio_ir
         drv_ctx.report_radio_event = notify;
         drv_ctx.irq_handler = dio_irq_handler;
         drv_ctx.modem = SID_PAL_RADIO_MODEM_MODE_LORA;
+#ifdef CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE
+        semtech_cmd_cache_init(&drv_ctx.cmd_cache);
+#endif /* CONFIG_SIDEWALK_SUBGHZ_CMD_CACHE */
 
         sid_pal_radio_set_region(drv_ctx.config->regional_config.radio_region);
 
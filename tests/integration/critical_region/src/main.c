@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 #include <sid_pal_critical_region_ifc.h>
+#include <sid_critical_region_ext.h>
 #include <sid_error.h>
 #include <zephyr/ztest.h>
 #include <zephyr/irq.h>
@@ -47,11 +48,16 @@ static void soc_irq_trigger(int irq)
 #endif /* CONFIG_SOC */
 }
 
-ZTEST(sid_pal_suite, test_critical_region_with_timer)
+static void *critical_region_setup(void)
 {
 	IRQ_CONNECT(TEST_IRQ, TEST_IRQ_PRIO, irq_cb, NULL, TEST_IRQ_FLAGS);
 	soc_irq_enable(TEST_IRQ);
 
+	return NULL;
+}
+
+ZTEST(sid_pal_suite, test_critical_region_with_timer)
+{
 	resource = UNCHANGED;
 	soc_irq_trigger(TEST_IRQ);
 	zassert_equal(resource, CHANGED, "IRQ should change resource");
@@ -66,4 +72,81 @@ ZTEST(sid_pal_suite, test_critical_region_with_timer)
 	zassert_equal(resource, CHANGED, "IRQ should change resource after critical section");
 }
 
-ZTEST_SUITE(sid_pal_suite, NULL, NULL, NULL, NULL, NULL);
+ZTEST(sid_pal_suite, test_critical_region_nested)
+{
+	sid_pal_enter_critical_region();
+	sid_pal_enter_critical_region();
+	sid_pal_enter_critical_region();
+	resource = UNCHANGED;
+	soc_irq_trigger(TEST_IRQ);
+	sid_pal_exit_critical_region();
+	zassert_equal(resource, UNCHANGED, "Resource should not change in nested section");
+	sid_pal_exit_critical_region();
+	zassert_equal(resource, UNCHANGED, "Resource should not change in nested section");
+	sid_pal_exit_critical_region();
+	zassert_equal(resource, CHANGED, "Pending IRQ should run after the outermost exit");
+}
+
+#if defined(CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO)
+#define TEST_IRQ_PRIO_UNMASKED (CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO_LEVEL - 1)
+
+ZTEST(sid_pal_suite, test_critical_region_high_prio_irq)
+{
+	if (CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO_LEVEL == 0) {
+		ztest_test_skip();
+	}
+	NVIC_SetPriority(TEST_IRQ, _IRQ_PRIO_OFFSET + TEST_IRQ_PRIO_UNMASKED);
+
+	sid_pal_enter_critical_region();
+	resource = UNCHANGED;
+	soc_irq_trigger(TEST_IRQ);
+	zassert_equal(resource, CHANGED, "High priority IRQ should run in critical section");
+	sid_pal_exit_critical_region();
+
+	NVIC_SetPriority(TEST_IRQ, _IRQ_PRIO_OFFSET + TEST_IRQ_PRIO);
+}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_MASK_PRIO */
+
+#if defined(CONFIG_SIDEWALK_CRITICAL_REGION_STATS)
+static void critical_section_long(void)
+{
+	sid_pal_enter_critical_region();
+	sid_pal_enter_critical_region();
+	k_busy_wait(200);
+	sid_pal_exit_critical_region();
+	sid_pal_exit_critical_region();
+}
+
+ZTEST(sid_pal_suite, test_critical_region_stats)
+{
+	struct sid_critical_region_stats stats;
+
+	sid_critical_region_stats_reset();
+	critical_section_long();
+	critical_section_long();
+	sid_pal_enter_critical_region();
+	sid_pal_exit_critical_region();
+
+	sid_critical_region_stats_get(&stats);
+	zassert_equal(stats.sites_used, 2);
+	zassert_equal(stats.untracked, 0);
+	zassert_equal(stats.max_depth, 2);
+	zassert_true(stats.max_hold_us >= 200, "max hold %u us", stats.max_hold_us);
+
+	for (uint32_t i = 0; i < stats.sites_used; i++) {
+		if (stats.sites[i].max_depth == 2) {
+			zassert_equal(stats.sites[i].count, 2);
+			zassert_true(stats.sites[i].max_hold_us >= 200);
+		} else {
+			zassert_equal(stats.sites[i].count, 1);
+			zassert_equal(stats.sites[i].max_depth, 1);
+		}
+	}
+
+	sid_critical_region_stats_reset();
+	sid_critical_region_stats_get(&stats);
+	zassert_equal(stats.sites_used, 0);
+}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_STATS */
+
+ZTEST_SUITE(sid_pal_suite, NULL, critical_region_setup, NULL, NULL, NULL);
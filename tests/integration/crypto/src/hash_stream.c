@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_ext.h>
+#include <string.h>
+
+#define DATA_SIZE (1000)
+#define SHA256_LEN (32)
+#define SHA512_LEN (64)
+
+static uint8_t data[DATA_SIZE];
+static const uint8_t hmac_key[32] = { 0xAC, 0x1D, 0x05, 0x22, 0xAC, 0x1D, 0x05, 0x22,
+				      0xFA, 0xD4, 0xCC, 0x29, 0xFA, 0xD4, 0xCC, 0x29,
+				      0xDA, 0x3C, 0xEE, 0xA4, 0x82, 0x0D, 0xAA, 0x50,
+				      0xAC, 0xFE, 0xBB, 0x34, 0x1D, 0x05, 0x22, 0xAC };
+
+/* parts of odd sizes, larger and smaller than the hash block */
+static const size_t part_sizes[] = { 1, 31, 64, 200, 3, 129, 572 };
+
+static void hash_stream_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i * 7;
+	}
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+}
+
+static void hash_stream_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+static void hash_compare(sid_pal_hash_algo_t algo, size_t digest_size)
+{
+	struct sid_pal_crypto_hash_ctx ctx;
+	uint8_t expected[SHA512_LEN];
+	uint8_t digest[SHA512_LEN];
+	size_t offset = 0;
+	sid_pal_hash_params_t params = {
+		.algo = algo,
+		.data = data,
+		.data_size = sizeof(data),
+		.digest = expected,
+		.digest_size = digest_size,
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash(&params));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_start(&ctx, algo));
+	for (int i = 0; i < ARRAY_SIZE(part_sizes); i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_crypto_hash_update(&ctx, data + offset, part_sizes[i]));
+		offset += part_sizes[i];
+	}
+	zassert_equal(sizeof(data), offset);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_finish(&ctx, digest, digest_size));
+	zassert_mem_equal(expected, digest, digest_size);
+}
+
+ZTEST(crypto_stream, test_hash_sha256_parts)
+{
+	hash_compare(SID_PAL_HASH_SHA256, SHA256_LEN);
+}
+
+ZTEST(crypto_stream, test_hash_sha512_parts)
+{
+	hash_compare(SID_PAL_HASH_SHA512, SHA512_LEN);
+}
+
+ZTEST(crypto_stream, test_hash_invalid)
+{
+	struct sid_pal_crypto_hash_ctx ctx;
+	uint8_t digest[SHA256_LEN];
+
+	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_crypto_hash_start(NULL, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NOSUPPORT, sid_pal_crypto_hash_start(&ctx, 0));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_start(&ctx, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_crypto_hash_update(&ctx, NULL, 1));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, NULL, 0));
+	// Digest buffer too small, the operation ends
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_hash_finish(&ctx, digest, 16));
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, data, 1));
+	sid_pal_crypto_hash_abort(&ctx);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+	zassert_equal(SID_ERROR_UNINITIALIZED,
+		      sid_pal_crypto_hash_start(&ctx, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+}
+
+ZTEST(crypto_stream, test_hmac_sha256_parts)
+{
+	struct sid_pal_crypto_hmac_ctx ctx;
+	uint8_t expected[SHA256_LEN];
+	uint8_t digest[SHA256_LEN];
+	size_t offset = 0;
+	sid_pal_hmac_params_t params = {
+		.algo = SID_PAL_HASH_SHA256,
+		.key = hmac_key,
+		.key_size = sizeof(hmac_key),
+		.data = data,
+		.data_size = sizeof(data),
+		.digest = expected,
+		.digest_size = sizeof(expected),
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac(&params));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_start(&ctx, SID_PAL_HASH_SHA256, hmac_key,
+							       sizeof(hmac_key)));
+	for (int i = 0; i < ARRAY_SIZE(part_sizes); i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_crypto_hmac_update(&ctx, data + offset, part_sizes[i]));
+		offset += part_sizes[i];
+	}
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_finish(&ctx, digest, sizeof(digest)));
+	zassert_mem_equal(expected, digest, sizeof(digest));
+
+	// The operation ended, abort does nothing
+	sid_pal_crypto_hmac_abort(&ctx);
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_update(&ctx, data, 1));
+}
+
+ZTEST(crypto_stream, test_hmac_abort)
+{
+	struct sid_pal_crypto_hmac_ctx ctx;
+	uint8_t digest[SHA256_LEN];
+
+	zassert_equal(SID_ERROR_NULL_POINTER,
+		      sid_pal_crypto_hmac_start(&ctx, SID_PAL_HASH_SHA256, NULL, 0));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_crypto_hmac_start(&ctx, SID_PAL_HASH_SHA256, hmac_key, 0));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_start(&ctx, SID_PAL_HASH_SHA256, hmac_key,
+							       sizeof(hmac_key)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_update(&ctx, data, sizeof(data)));
+	sid_pal_crypto_hmac_abort(&ctx);
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_finish(&ctx, digest, sizeof(digest)));
+}
+
+ZTEST_SUITE(crypto_stream, NULL, NULL, hash_stream_before, hash_stream_after, NULL);
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_key_cache.h>
+#include <string.h>
+
+#define KEY_SIZE (16)
+#define IV_SIZE (16)
+#define DATA_SIZE (32)
+
+static const uint8_t test_data[DATA_SIZE] = { "Sidewalk key cache test data..." };
+
+static void key_fill(uint8_t *key, uint8_t seed)
+{
+	for (size_t i = 0; i < KEY_SIZE; i++) {
+		key[i] = seed + i;
+	}
+}
+
+static void aes_ctr(uint8_t *key, sid_pal_aes_mode_t mode, const uint8_t *in, uint8_t *out)
+{
+	uint8_t iv[IV_SIZE];
+	sid_pal_aes_params_t params = {
+		.algo = SID_PAL_AES_CTR_128,
+		.mode = mode,
+		.key = key,
+		.key_size = KEY_SIZE * 8,
+		.iv = iv,
+		.iv_size = sizeof(iv),
+		.in = in,
+		.in_size = DATA_SIZE,
+		.out = out,
+		.out_size = DATA_SIZE,
+	};
+
+	memset(iv, 0xB1, sizeof(iv));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aes_crypt(&params));
+}
+
+static void stats_expect(uint32_t hits, uint32_t misses, uint32_t evictions)
+{
+	struct sid_crypto_key_cache_stats stats;
+
+	sid_crypto_key_cache_stats_get(&stats);
+	zassert_equal(hits, stats.hits, "hits %u", stats.hits);
+	zassert_equal(misses, stats.misses, "misses %u", stats.misses);
+	zassert_equal(evictions, stats.evictions, "evictions %u", stats.evictions);
+	zassert_equal(0, stats.bypasses);
+}
+
+static void key_cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	sid_crypto_key_cache_clear();
+	sid_crypto_key_cache_stats_reset();
+}
+
+static void key_cache_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+ZTEST(crypto_key_cache, test_key_reused)
+{
+	uint8_t key[KEY_SIZE];
+	uint8_t first[DATA_SIZE];
+	uint8_t second[DATA_SIZE];
+
+	key_fill(key, 0x10);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, first);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, second);
+	stats_expect(1, 1, 0);
+	zassert_mem_equal(first, second, sizeof(first));
+}
+
+ZTEST(crypto_key_cache, test_usage_separate)
+{
+	uint8_t key[KEY_SIZE];
+	uint8_t encrypted[DATA_SIZE];
+	uint8_t decrypted[DATA_SIZE];
+
+	key_fill(key, 0x20);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, encrypted);
+	aes_ctr(key, SID_PAL_CRYPTO_DECRYPT, encrypted, decrypted);
+	stats_expect(0, 2, 0);
+	zassert_mem_equal(test_data, decrypted, sizeof(test_data));
+}
+
+ZTEST(crypto_key_cache, test_key_material_compared)
+{
+	uint8_t key[KEY_SIZE];
+	uint8_t first[DATA_SIZE];
+	uint8_t second[DATA_SIZE];
+
+	key_fill(key, 0x30);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, first);
+	key[KEY_SIZE - 1] ^= 0x01;
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, second);
+	stats_expect(0, 2, 0);
+	zassert_true(memcmp(first, second, sizeof(first)));
+}
+
+ZTEST(crypto_key_cache, test_lru_evicted)
+{
+	uint8_t key[KEY_SIZE];
+	uint8_t expected[DATA_SIZE];
+	uint8_t out[DATA_SIZE];
+
+	key_fill(key, 0);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, expected);
+	for (uint8_t i = 1; i <= CONFIG_SIDEWALK_CRYPTO_KEY_CACHE_ENTRIES; i++) {
+		key_fill(key, i);
+		aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, out);
+	}
+	stats_expect(0, CONFIG_SIDEWALK_CRYPTO_KEY_CACHE_ENTRIES + 1, 1);
+
+	/* the first key was the least recently used one */
+	key_fill(key, 0);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, out);
+	stats_expect(0, CONFIG_SIDEWALK_CRYPTO_KEY_CACHE_ENTRIES + 2, 2);
+	zassert_mem_equal(expected, out, sizeof(out));
+
+	/* the last key is still cached */
+	key_fill(key, CONFIG_SIDEWALK_CRYPTO_KEY_CACHE_ENTRIES);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, out);
+	stats_expect(1, CONFIG_SIDEWALK_CRYPTO_KEY_CACHE_ENTRIES + 2, 2);
+}
+
+ZTEST(crypto_key_cache, test_hmac_and_aead_cached)
+{
+	uint8_t key[KEY_SIZE];
+	uint8_t iv[12] = { 0 };
+	uint8_t aad[8] = { 0 };
+	uint8_t out[DATA_SIZE];
+	uint8_t mac[16];
+	uint8_t digest[32];
+	sid_pal_hmac_params_t hmac = {
+		.algo = SID_PAL_HASH_SHA256,
+		.key = key,
+		.key_size = sizeof(key),
+		.data = test_data,
+		.data_size = sizeof(test_data),
+		.digest = digest,
+		.digest_size = sizeof(digest),
+	};
+	sid_pal_aead_params_t aead = {
+		.algo = SID_PAL_AEAD_GCM_128,
+		.mode = SID_PAL_CRYPTO_ENCRYPT,
+		.key = key,
+		.key_size = sizeof(key) * 8,
+		.iv = iv,
+		.iv_size = sizeof(iv),
+		.aad = aad,
+		.aad_size = sizeof(aad),
+		.in = test_data,
+		.in_size = sizeof(test_data),
+		.out = out,
+		.out_size = sizeof(out),
+		.mac = mac,
+		.mac_size = sizeof(mac),
+	};
+
+	key_fill(key, 0x40);
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac(&hmac));
+		zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aead_crypt(&aead));
+	}
+	stats_expect(4, 2, 0);
+}
+
+ZTEST(crypto_key_cache, test_deinit_clears)
+{
+	uint8_t key[KEY_SIZE];
+	uint8_t out[DATA_SIZE];
+
+	key_fill(key, 0x50);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, out);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, out);
+	stats_expect(0, 2, 0);
+}
+
+ZTEST(crypto_key_cache, test_clear_keeps_key_in_use)
+{
+	uint8_t key[KEY_SIZE];
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_key_attributes_t read_attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_key_id_t in_use;
+	psa_key_id_t imported;
+
+	key_fill(key, 0x70);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attributes, KEY_SIZE * 8);
+	psa_set_key_algorithm(&attributes, PSA_ALG_CTR);
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
+
+	zassert_equal(PSA_SUCCESS,
+		      sid_crypto_key_cache_get(key, sizeof(key), &attributes, &in_use));
+	sid_crypto_key_cache_clear();
+	zassert_equal(PSA_SUCCESS, psa_get_key_attributes(in_use, &read_attributes));
+
+	/* the cleared key is not found, the key is imported again */
+	zassert_equal(PSA_SUCCESS,
+		      sid_crypto_key_cache_get(key, sizeof(key), &attributes, &imported));
+	zassert_not_equal(in_use, imported);
+	stats_expect(0, 2, 0);
+
+	sid_crypto_key_cache_put(in_use);
+	zassert_not_equal(PSA_SUCCESS, psa_get_key_attributes(in_use, &read_attributes));
+	zassert_equal(PSA_SUCCESS, psa_get_key_attributes(imported, &read_attributes));
+	sid_crypto_key_cache_put(imported);
+	psa_reset_key_attributes(&read_attributes);
+}
+
+ZTEST(crypto_key_cache, test_key_agreement_clears)
+{
+	uint8_t key[KEY_SIZE];
+	uint8_t out[DATA_SIZE];
+	uint8_t private_key[32];
+	uint8_t public_key[32];
+	uint8_t secret[32];
+	sid_pal_ecc_key_gen_params_t key_gen = {
+		.algo = SID_PAL_ECDH_CURVE25519,
+		.prk = private_key,
+		.prk_size = sizeof(private_key),
+		.puk = public_key,
+		.puk_size = sizeof(public_key),
+	};
+	sid_pal_ecdh_params_t ecdh = {
+		.algo = SID_PAL_ECDH_CURVE25519,
+		.prk = private_key,
+		.prk_size = sizeof(private_key),
+		.puk = public_key,
+		.puk_size = sizeof(public_key),
+		.shared_secret = secret,
+		.shared_secret_sz = sizeof(secret),
+	};
+
+	key_fill(key, 0x60);
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, out);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_ecc_key_gen(&key_gen));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_ecc_ecdh(&ecdh));
+
+	/* the session keys of the previous agreement are imported again */
+	aes_ctr(key, SID_PAL_CRYPTO_ENCRYPT, test_data, out);
+	stats_expect(0, 2, 0);
+}
+
+ZTEST_SUITE(crypto_key_cache, NULL, NULL, key_cache_before, key_cache_after, NULL);
@@ -1408,6 +1408,61 @@ ZTEST(crypto, test_sid_pal_crypto_aead_ccm_self_test)
 	zassert_equal(0, memcmp(data_copy, decrypted_data, sizeof(data_copy)));
 }
 
+ZTEST(crypto, test_sid_pal_crypto_aead_mac_after_data)
+{
+	sid_pal_aead_params_t params;
+
+	uint8_t additional_data[AES_TEST_DATA_BLOCK_SIZE] = { "Additional data..." };
+	uint8_t iv[AES_GCM_IV_SIZE];
+	uint8_t encrypted_data[AES_TEST_DATA_BLOCK_SIZE];
+	uint8_t mac[AES_MAX_BLOCK_SIZE];
+	// Encrypted data followed by its MAC, as in a received frame
+	uint8_t frame[AES_TEST_DATA_BLOCK_SIZE + AES_MAX_BLOCK_SIZE];
+	uint8_t decrypted_data[AES_TEST_DATA_BLOCK_SIZE];
+
+	// Prepare test
+	memset(&params, 0x00, sizeof(params));
+	memset(iv, 0xB1, AES_GCM_IV_SIZE);
+
+	// Initialize crypto module
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+
+	params.algo = SID_PAL_AEAD_GCM_128;
+	params.mode = SID_PAL_CRYPTO_ENCRYPT;
+	params.key = aes_128_test_key;
+	params.key_size = sizeof(aes_128_test_key) * 8;
+	params.iv = iv;
+	params.iv_size = AES_GCM_IV_SIZE;
+	params.aad = additional_data;
+	params.aad_size = sizeof(additional_data);
+	params.in = test_string;
+	params.in_size = AES_TEST_DATA_BLOCK_SIZE;
+	params.out = encrypted_data;
+	params.out_size = sizeof(encrypted_data);
+	params.mac = mac;
+	params.mac_size = sizeof(mac);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aead_crypt(&params));
+
+	// Encrypt to the frame, the MAC follows the encrypted data
+	params.out = frame;
+	params.mac = frame + AES_TEST_DATA_BLOCK_SIZE;
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aead_crypt(&params));
+	zassert_equal(0, memcmp(encrypted_data, frame, sizeof(encrypted_data)));
+	zassert_equal(0, memcmp(mac, frame + AES_TEST_DATA_BLOCK_SIZE, sizeof(mac)));
+
+	// Decrypt the frame
+	params.mode = SID_PAL_CRYPTO_DECRYPT;
+	params.in = frame;
+	params.out = decrypted_data;
+	params.out_size = sizeof(decrypted_data);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aead_crypt(&params));
+	zassert_equal(0, memcmp(test_string, decrypted_data, sizeof(decrypted_data)));
+
+	// Bad MAC in the frame
+	frame[sizeof(frame) - 1] ^= 0x01;
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_aead_crypt(&params));
+}
+
 ZTEST(crypto, test_sid_pal_crypto_aead_ccm_external_encrypted_data)
 {
 	sid_pal_aead_params_t params;
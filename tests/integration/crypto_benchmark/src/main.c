@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <sid_pal_crypto_ifc.h>
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+#include <sid_crypto_key_cache.h>
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+#include <string.h>
+
+/* rounds of every measurement, asymmetric operations are orders of magnitude slower */
+#define SYM_ROUNDS 64
+#define ASYM_ROUNDS 4
+
+#define FRAME_SIZE_MAX 255
+#define SIGNED_MSG_SIZE 64
+#define AES_KEY_SIZE 16
+#define HMAC_KEY_SIZE 32
+#define GCM_IV_SIZE 12
+#define CCM_IV_SIZE 13
+#define AES_MAC_SIZE 16
+#define SHA512_LEN 64
+#define ECC_PRIVATE_KEY_LEN 32
+#define ECC_PUBLIC_KEY_MAX_LEN 64
+#define ECC_SIGNATURE_SIZE 64
+
+/* frame sizes of the Sidewalk links, from a short BLE frame to a full FSK frame */
+static const size_t frame_sizes[] = { 16, 64, 128, FRAME_SIZE_MAX };
+
+static uint8_t aes_key[AES_KEY_SIZE];
+static uint8_t hmac_key[HMAC_KEY_SIZE];
+static uint8_t iv[AES_KEY_SIZE];
+static uint8_t aad[8];
+static uint8_t frame[FRAME_SIZE_MAX];
+static uint8_t sealed[FRAME_SIZE_MAX];
+static uint8_t opened[FRAME_SIZE_MAX];
+static uint8_t mac[SHA512_LEN];
+static uint8_t signature[ECC_SIGNATURE_SIZE];
+
+struct ecc_key_pair {
+	uint8_t prk[ECC_PRIVATE_KEY_LEN];
+	uint8_t puk[ECC_PUBLIC_KEY_MAX_LEN];
+	size_t puk_size;
+};
+
+static struct ecc_key_pair x25519[2];
+static struct ecc_key_pair p256[2];
+static struct ecc_key_pair ecdsa_p256;
+static struct ecc_key_pair ed25519;
+
+static sid_pal_aead_algo_t aead_algo;
+static bool key_import;
+
+static const char *backend_name(void)
+{
+	if (IS_ENABLED(CONFIG_PSA_CRYPTO_DRIVER_CRACEN)) {
+		return "CRACEN";
+	}
+	if (IS_ENABLED(CONFIG_PSA_CRYPTO_DRIVER_CC3XX)) {
+		return "CC3xx";
+	}
+	if (IS_ENABLED(CONFIG_PSA_CRYPTO_DRIVER_OBERON)) {
+		return "Oberon";
+	}
+	return "built-in";
+}
+
+/* size 0 is an operation on a fixed input, reported per operation only */
+static void bench_run(const char *name, sid_error_t (*op)(size_t size), size_t size, int rounds)
+{
+	uint64_t cycles = 0;
+
+	for (int round = 0; round < rounds; round++) {
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+		if (key_import) {
+			sid_crypto_key_cache_clear();
+		}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+		timing_t start = timing_counter_get();
+		sid_error_t err = op(size);
+		timing_t end = timing_counter_get();
+
+		zassert_equal(SID_ERROR_NONE, err, "%s %zu B failed %d", name, size, err);
+		cycles += timing_cycles_get(&start, &end);
+	}
+
+	const uint64_t ns = MAX(timing_cycles_to_ns(cycles), 1);
+	const uint32_t ops_per_s = (uint64_t)rounds * NSEC_PER_SEC / ns;
+	const uint32_t cycles_per_op = cycles / rounds;
+
+	if (!size) {
+		TC_PRINT("%-16s       %7u ops/s %9u cycles/op\n", name, ops_per_s, cycles_per_op);
+		return;
+	}
+	const uint32_t cycles_per_100_bytes = cycles * 100 / (rounds * size);
+
+	TC_PRINT("%-16s %3zu B %7u ops/s %9u cycles/op %5u.%02u cycles/B\n", name, size,
+		 ops_per_s, cycles_per_op, cycles_per_100_bytes / 100, cycles_per_100_bytes % 100);
+}
+
+static sid_error_t aes_ctr(size_t size)
+{
+	sid_pal_aes_params_t params = {
+		.algo = SID_PAL_AES_CTR_128,
+		.mode = SID_PAL_CRYPTO_ENCRYPT,
+		.key = aes_key,
+		.key_size = sizeof(aes_key) * 8,
+		.iv = iv,
+		.iv_size = sizeof(iv),
+		.in = frame,
+		.in_size = size,
+		.out = sealed,
+		.out_size = size,
+	};
+
+	return sid_pal_crypto_aes_crypt(&params);
+}
+
+static sid_error_t aes_cmac(size_t size)
+{
+	sid_pal_aes_params_t params = {
+		.algo = SID_PAL_AES_CMAC_128,
+		.mode = SID_PAL_CRYPTO_MAC_CALCULATE,
+		.key = aes_key,
+		.key_size = sizeof(aes_key) * 8,
+		.in = frame,
+		.in_size = size,
+		.out = mac,
+		.out_size = AES_MAC_SIZE,
+	};
+
+	return sid_pal_crypto_aes_crypt(&params);
+}
+
+static sid_error_t aead(sid_pal_aes_mode_t mode, size_t size)
+{
+	sid_pal_aead_params_t params = {
+		.algo = aead_algo,
+		.mode = mode,
+		.key = aes_key,
+		.key_size = sizeof(aes_key) * 8,
+		.iv = iv,
+		.iv_size = (SID_PAL_AEAD_GCM_128 == aead_algo) ? GCM_IV_SIZE : CCM_IV_SIZE,
+		.aad = aad,
+		.aad_size = sizeof(aad),
+		.in = (SID_PAL_CRYPTO_ENCRYPT == mode) ? frame : sealed,
+		.in_size = size,
+		.out = (SID_PAL_CRYPTO_ENCRYPT == mode) ? sealed : opened,
+		.out_size = size,
+		.mac = mac,
+		.mac_size = AES_MAC_SIZE,
+	};
+
+	return sid_pal_crypto_aead_crypt(&params);
+}
+
+static sid_error_t aead_seal(size_t size)
+{
+	return aead(SID_PAL_CRYPTO_ENCRYPT, size);
+}
+
+/* opens the frame sealed last, with its MAC */
+static sid_error_t aead_open(size_t size)
+{
+	return aead(SID_PAL_CRYPTO_DECRYPT, size);
+}
+
+static sid_error_t hash(sid_pal_hash_algo_t algo, size_t size)
+{
+	sid_pal_hash_params_t params = {
+		.algo = algo,
+		.data = frame,
+		.data_size = size,
+		.digest = mac,
+		.digest_size = (SID_PAL_HASH_SHA256 == algo) ? 32 : SHA512_LEN,
+	};
+
+	return sid_pal_crypto_hash(&params);
+}
+
+static sid_error_t sha256(size_t size)
+{
+	return hash(SID_PAL_HASH_SHA256, size);
+}
+
+static sid_error_t sha512(size_t size)
+{
+	return hash(SID_PAL_HASH_SHA512, size);
+}
+
+static sid_error_t hmac_sha256(size_t size)
+{
+	sid_pal_hmac_params_t params = {
+		.algo = SID_PAL_HASH_SHA256,
+		.key = hmac_key,
+		.key_size = sizeof(hmac_key),
+		.data = frame,
+		.data_size = size,
+		.digest = mac,
+		.digest_size = 32,
+	};
+
+	return sid_pal_crypto_hmac(&params);
+}
+
+static sid_error_t ecdh(sid_pal_ecc_algo_t algo, struct ecc_key_pair *pairs)
+{
+	uint8_t secret[32];
+	sid_pal_ecdh_params_t params = {
+		.algo = algo,
+		.prk = pairs[0].prk,
+		.prk_size = sizeof(pairs[0].prk),
+		.puk = pairs[1].puk,
+		.puk_size = pairs[1].puk_size,
+		.shared_secret = secret,
+		.shared_secret_sz = sizeof(secret),
+	};
+
+	return sid_pal_crypto_ecc_ecdh(&params);
+}
+
+static sid_error_t ecdh_x25519(size_t size)
+{
+	ARG_UNUSED(size);
+	return ecdh(SID_PAL_ECDH_CURVE25519, x25519);
+}
+
+static sid_error_t ecdh_p256(size_t size)
+{
+	ARG_UNUSED(size);
+	return ecdh(SID_PAL_ECDH_SECP256R1, p256);
+}
+
+static sid_error_t dsa(sid_pal_ecc_algo_t algo, sid_pal_dsa_mode_t mode, struct ecc_key_pair *pair)
+{
+	sid_pal_dsa_params_t params = {
+		.algo = algo,
+		.mode = mode,
+		.key = (SID_PAL_CRYPTO_SIGN == mode) ? pair->prk : pair->puk,
+		.key_size = (SID_PAL_CRYPTO_SIGN == mode) ? sizeof(pair->prk) : pair->puk_size,
+		.in = frame,
+		.in_size = SIGNED_MSG_SIZE,
+		.signature = signature,
+		.sig_size = sizeof(signature),
+	};
+
+	return sid_pal_crypto_ecc_dsa(&params);
+}
+
+static sid_error_t ecdsa_sign(size_t size)
+{
+	ARG_UNUSED(size);
+	return dsa(SID_PAL_ECDSA_SECP256R1, SID_PAL_CRYPTO_SIGN, &ecdsa_p256);
+}
+
+static sid_error_t ecdsa_verify(size_t size)
+{
+	ARG_UNUSED(size);
+	return dsa(SID_PAL_ECDSA_SECP256R1, SID_PAL_CRYPTO_VERIFY, &ecdsa_p256);
+}
+
+static sid_error_t ed25519_sign(size_t size)
+{
+	ARG_UNUSED(size);
+	return dsa(SID_PAL_EDDSA_ED25519, SID_PAL_CRYPTO_SIGN, &ed25519);
+}
+
+static sid_error_t ed25519_verify(size_t size)
+{
+	ARG_UNUSED(size);
+	return dsa(SID_PAL_EDDSA_ED25519, SID_PAL_CRYPTO_VERIFY, &ed25519);
+}
+
+static void key_gen(sid_pal_ecc_algo_t algo, struct ecc_key_pair *pair, size_t puk_size)
+{
+	sid_pal_ecc_key_gen_params_t params = {
+		.algo = algo,
+		.prk = pair->prk,
+		.prk_size = sizeof(pair->prk),
+		.puk = pair->puk,
+		.puk_size = puk_size,
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_ecc_key_gen(&params));
+	pair->puk_size = puk_size;
+}
+
+static void *crypto_benchmark_setup(void)
+{
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(aes_key, sizeof(aes_key)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(hmac_key, sizeof(hmac_key)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(frame, sizeof(frame)));
+
+	for (int i = 0; i < ARRAY_SIZE(x25519); i++) {
+		key_gen(SID_PAL_ECDH_CURVE25519, &x25519[i], 32);
+		key_gen(SID_PAL_ECDH_SECP256R1, &p256[i], 64);
+	}
+	key_gen(SID_PAL_ECDSA_SECP256R1, &ecdsa_p256, 64);
+	key_gen(SID_PAL_EDDSA_ED25519, &ed25519, 32);
+
+	timing_init();
+	timing_start();
+	TC_PRINT("PSA crypto backend: %s, key cache %s\n", backend_name(),
+		 IS_ENABLED(CONFIG_SIDEWALK_CRYPTO_KEY_CACHE) ? "on" : "off");
+	return NULL;
+}
+
+static void crypto_benchmark_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	timing_stop();
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+static void crypto_benchmark_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	key_import = false;
+}
+
+ZTEST(crypto_benchmark, test_benchmark_aes)
+{
+	for (int i = 0; i < ARRAY_SIZE(frame_sizes); i++) {
+		bench_run("AES-CTR", aes_ctr, frame_sizes[i], SYM_ROUNDS);
+	}
+	for (int i = 0; i < ARRAY_SIZE(frame_sizes); i++) {
+		bench_run("AES-CMAC", aes_cmac, frame_sizes[i], SYM_ROUNDS);
+	}
+}
+
+ZTEST(crypto_benchmark, test_benchmark_aead)
+{
+	const sid_pal_aead_algo_t algos[] = { SID_PAL_AEAD_GCM_128, SID_PAL_AEAD_CCM_128 };
+
+	const char *const names[][2] = { { "GCM encrypt", "GCM decrypt" },
+					 { "CCM encrypt", "CCM decrypt" } };
+
+	for (int a = 0; a < ARRAY_SIZE(algos); a++) {
+		aead_algo = algos[a];
+		for (int i = 0; i < ARRAY_SIZE(frame_sizes); i++) {
+			const size_t size = frame_sizes[i];
+
+			bench_run(names[a][0], aead_seal, size, SYM_ROUNDS);
+			bench_run(names[a][1], aead_open, size, SYM_ROUNDS);
+			zassert_mem_equal(frame, opened, size);
+		}
+	}
+}
+
+ZTEST(crypto_benchmark, test_benchmark_hash)
+{
+	for (int i = 0; i < ARRAY_SIZE(frame_sizes); i++) {
+		bench_run("SHA-256", sha256, frame_sizes[i], SYM_ROUNDS);
+	}
+	for (int i = 0; i < ARRAY_SIZE(frame_sizes); i++) {
+		bench_run("SHA-512", sha512, frame_sizes[i], SYM_ROUNDS);
+	}
+	for (int i = 0; i < ARRAY_SIZE(frame_sizes); i++) {
+		bench_run("HMAC-SHA256", hmac_sha256, frame_sizes[i], SYM_ROUNDS);
+	}
+}
+
+ZTEST(crypto_benchmark, test_benchmark_ecc)
+{
+	bench_run("ECDH X25519", ecdh_x25519, 0, ASYM_ROUNDS);
+	bench_run("ECDH P-256", ecdh_p256, 0, ASYM_ROUNDS);
+	bench_run("ECDSA P-256 sign", ecdsa_sign, 0, ASYM_ROUNDS);
+	bench_run("ECDSA P-256 vrfy", ecdsa_verify, 0, ASYM_ROUNDS);
+	bench_run("Ed25519 sign", ed25519_sign, 0, ASYM_ROUNDS);
+	bench_run("Ed25519 verify", ed25519_verify, 0, ASYM_ROUNDS);
+}
+
+ZTEST(crypto_benchmark, test_benchmark_key_import)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SIDEWALK_CRYPTO_KEY_CACHE);
+
+	/* every operation imports its key, as without the key cache */
+	key_import = true;
+	aead_algo = SID_PAL_AEAD_GCM_128;
+	bench_run("GCM encrypt imp", aead_seal, 64, SYM_ROUNDS);
+	bench_run("AES-CMAC imp", aes_cmac, 64, SYM_ROUNDS);
+	bench_run("HMAC-SHA256 imp", hmac_sha256, 64, SYM_ROUNDS);
+}
+
+ZTEST_SUITE(crypto_benchmark, NULL, crypto_benchmark_setup, crypto_benchmark_before, NULL,
+	    crypto_benchmark_teardown);
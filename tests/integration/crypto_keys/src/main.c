@@ -318,4 +318,31 @@ ZTEST(crypto_keys, test_sid_crypto_key_generate)
 	}
 }
 
+ZTEST(crypto_keys, test_sid_crypto_key_delete_batch)
+{
+	const psa_key_id_t ids[] = { SID_CRYPTO_KV_WAN_MASTER_KEY_ID, SID_CRYPTO_KV_APP_KEY_KEY_ID,
+				     SID_CRYPTO_KV_D2D_KEY_ID };
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	int err;
+
+	err = sid_crypto_keys_new_import(SID_CRYPTO_KV_WAN_MASTER_KEY_ID, (uint8_t *)test_wan_key,
+					 sizeof(test_wan_key));
+	zassert_equal(0, err, "err: %d", err);
+	err = sid_crypto_keys_new_import(SID_CRYPTO_KV_D2D_KEY_ID, (uint8_t *)test_d2d_key,
+					 sizeof(test_d2d_key));
+	zassert_equal(0, err, "err: %d", err);
+
+	/* the app key does not exist, it is skipped */
+	err = sid_crypto_keys_delete_batch(ids, ARRAY_SIZE(ids));
+	zassert_equal(0, err, "err: %d", err);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ids); i++) {
+		zassert_not_equal(PSA_SUCCESS, psa_get_key_attributes(ids[i], &attributes));
+		psa_reset_key_attributes(&attributes);
+	}
+
+	err = sid_crypto_keys_delete_batch(NULL, ARRAY_SIZE(ids));
+	zassert_equal(-EINVAL, err, "err: %d", err);
+}
+
 ZTEST_SUITE(crypto_keys, NULL, setup, before, after, teardown);
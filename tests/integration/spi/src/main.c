@@ -19,6 +19,7 @@
 #include <sid_pal_gpio_ifc.h>
 #include <sid_pal_serial_bus_ifc.h>
 #include <sid_pal_serial_bus_spi_config.h>
+#include <sid_serial_bus_ext.h>
 
 #define NULL_STRUCT_INITIALIZER { 0 }
 #define INVALID_DT_GPIO NULL_STRUCT_INITIALIZER
@@ -120,6 +121,138 @@ ZTEST(spi_bus, test_only_tx_spi)
 	zassert_equal(SID_ERROR_NONE, e);
 }
 
+ZTEST(spi_bus, test_xfer_v_invalid_args)
+{
+	const struct sid_pal_serial_bus_iface *interface = NULL;
+	const struct sid_pal_serial_bus_iface interface2;
+	struct sid_pal_serial_bus_client client = { 0 };
+	uint8_t tx[] = { 0x1d, 0x08, 0xac };
+	struct sid_pal_serial_bus_buf bufs[SID_PAL_SERIAL_BUS_BUFS_MAX + 1] = { 0 };
+
+	for (size_t i = 0; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i] = (struct sid_pal_serial_bus_buf){ .tx = tx, .len = sizeof(tx) };
+	}
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_nordic_spi_create(&interface, NULL));
+	zassert_equal(SID_ERROR_INVALID_ARGS, sid_pal_serial_bus_xfer_v(NULL, &client, bufs, 1));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_serial_bus_xfer_v(&interface2, &client, bufs, 1));
+	zassert_equal(SID_ERROR_INVALID_ARGS, sid_pal_serial_bus_xfer_v(interface, NULL, bufs, 1));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_serial_bus_xfer_v(interface, &client, NULL, 1));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_serial_bus_xfer_v(interface, &client, bufs, 0));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_serial_bus_xfer_v(interface, &client, bufs, ARRAY_SIZE(bufs)));
+	bufs[1].len = 0;
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_serial_bus_xfer_v(interface, &client, bufs, 2));
+}
+
+ZTEST(spi_bus, test_xfer_v_spi)
+{
+	const struct sid_pal_serial_bus_iface *interface = NULL;
+	struct sid_pal_serial_bus_client client;
+	client.client_selector =
+		sid_gpio_utils_register_gpio((struct gpio_dt_spec)GPIO_DT_SPEC_GET_OR(
+			DT_NODELABEL(sid_semtech), cs_gpios, INVALID_DT_GPIO));
+	sid_pal_gpio_set_direction(client.client_selector, SID_PAL_GPIO_DIRECTION_OUTPUT);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_nordic_spi_create(&interface, NULL));
+	uint8_t cmd[] = { 0x1d, 0x08, 0xac };
+	uint8_t stat[2] = { 0 };
+	uint8_t data[4] = { 0 };
+	const struct sid_pal_serial_bus_buf bufs[] = {
+		{ .tx = cmd, .rx = stat, .len = sizeof(stat) },
+		{ .tx = &cmd[sizeof(stat)], .len = sizeof(cmd) - sizeof(stat) },
+		{ .tx = data, .rx = data, .len = sizeof(data) },
+	};
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_serial_bus_xfer_v(interface, &client, bufs, ARRAY_SIZE(bufs)));
+
+	/* Receive only, the idle pattern is sent */
+	const struct sid_pal_serial_bus_buf rx_only = { .rx = data, .len = sizeof(data) };
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_xfer_v(interface, &client, &rx_only, 1));
+}
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_ASYNC
+static void xfer_done(sid_error_t result, void *user_data)
+{
+	*(sid_error_t *)user_data = result;
+}
+
+ZTEST(spi_bus, test_xfer_v_async_spi)
+{
+	const struct sid_pal_serial_bus_iface *interface = NULL;
+	struct sid_pal_serial_bus_client client = { 0 };
+	uint8_t data[64];
+	sid_error_t result = SID_ERROR_GENERIC;
+	const struct sid_pal_serial_bus_buf buf = { .tx = data, .len = sizeof(data) };
+
+	memset(data, 0xa5, sizeof(data));
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_nordic_spi_create(&interface, NULL));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_serial_bus_xfer_v_async(interface, &client, &buf, 0, NULL, NULL));
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_xfer_v_async(interface, &client, &buf, 1,
+								       xfer_done, &result));
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_flush(interface));
+	zassert_equal(SID_ERROR_NONE, result);
+
+	/* A synchronous transfer waits for the pending one */
+	result = SID_ERROR_GENERIC;
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_xfer_v_async(interface, &client, &buf, 1,
+								       xfer_done, &result));
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_xfer_v(interface, &client, &buf, 1));
+	zassert_equal(SID_ERROR_NONE, result);
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_flush(interface));
+}
+
+#ifdef CONFIG_SIDEWALK_SPI_BUS_STATS
+#define BENCH_PACKETS 32
+#define BENCH_PACKET_LEN 255
+/* Work done by the Sidewalk thread between the packet write and the next radio command */
+#define BENCH_WORK_US 300
+
+static uint32_t bench_blocked_us(bool async)
+{
+	const struct sid_pal_serial_bus_iface *interface = NULL;
+	struct sid_pal_serial_bus_client client = { 0 };
+	static uint8_t packet[BENCH_PACKET_LEN];
+	const struct sid_pal_serial_bus_buf buf = { .tx = packet, .len = sizeof(packet) };
+	struct sid_pal_serial_bus_stats stats;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_nordic_spi_create(&interface, NULL));
+	sid_pal_serial_bus_stats_reset();
+	for (int i = 0; i < BENCH_PACKETS; i++) {
+		sid_error_t e = async ? sid_pal_serial_bus_xfer_v_async(interface, &client, &buf, 1,
+									NULL, NULL)
+				      : sid_pal_serial_bus_xfer_v(interface, &client, &buf, 1);
+
+		zassert_equal(SID_ERROR_NONE, e);
+		k_busy_wait(BENCH_WORK_US);
+		zassert_equal(SID_ERROR_NONE, sid_pal_serial_bus_flush(interface));
+	}
+	sid_pal_serial_bus_stats_get(&stats);
+	zassert_equal(BENCH_PACKETS, stats.transfers);
+	zassert_equal(async ? BENCH_PACKETS : 0, stats.async_transfers);
+
+	return (uint32_t)(stats.blocked_us / BENCH_PACKETS);
+}
+
+ZTEST(spi_bus, test_xfer_async_benchmark)
+{
+	const uint32_t sync_us = bench_blocked_us(false);
+	const uint32_t async_us = bench_blocked_us(true);
+
+	printk("thread blocked per %d B packet: sync %u us, async %u us\n", BENCH_PACKET_LEN,
+	       sync_us, async_us);
+	zassert_true(async_us <= sync_us, "async write blocks longer than sync");
+}
+#endif /* CONFIG_SIDEWALK_SPI_BUS_STATS */
+#endif /* CONFIG_SIDEWALK_SPI_BUS_ASYNC */
+
 /* LR11xx GetVersion smoke test using sid_pal serial bus interface. */
 #if DT_NODE_EXISTS(DT_NODELABEL(lora_semtech_lr11xxmb1xxs))
 
@@ -0,0 +1,11 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+void z_log_minimal_printk(const char *fmt, ...)
+{
+	// dummy function for this module to comiple.
+	// logs won't be shown in unit test output.
+}
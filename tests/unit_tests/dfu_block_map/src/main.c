@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sbdt/dfu_block_map.h>
+#include <sid_pal_storage_kv_ifc.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+#include <errno.h>
+#include <string.h>
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_storage_kv_record_get, uint16_t, uint16_t, void *, uint32_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_storage_kv_record_set, uint16_t, uint16_t, void const *,
+		uint32_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_storage_kv_group_delete, uint16_t);
+
+#define BLOCK 128
+#define RECORDS 8
+
+static struct {
+	bool used;
+	uint8_t data[DFU_BLOCK_MAP_CHUNK_SIZE];
+	uint32_t len;
+} records[RECORDS];
+
+static struct dfu_block_map map;
+
+static sid_error_t record_get(uint16_t group, uint16_t key, void *p_data, uint32_t len)
+{
+	if (key >= RECORDS || !records[key].used) {
+		return SID_ERROR_NOT_FOUND;
+	}
+	memcpy(p_data, records[key].data, MIN(len, records[key].len));
+	return SID_ERROR_NONE;
+}
+
+static sid_error_t record_set(uint16_t group, uint16_t key, void const *p_data, uint32_t len)
+{
+	zassert_true(key < RECORDS);
+	zassert_true(len <= sizeof(records[key].data));
+	records[key].used = true;
+	records[key].len = len;
+	memcpy(records[key].data, p_data, len);
+	return SID_ERROR_NONE;
+}
+
+static sid_error_t group_delete(uint16_t group)
+{
+	memset(records, 0, sizeof(records));
+	return SID_ERROR_NONE;
+}
+
+static void setup(void *fixture)
+{
+	RESET_FAKE(sid_pal_storage_kv_record_get);
+	RESET_FAKE(sid_pal_storage_kv_record_set);
+	RESET_FAKE(sid_pal_storage_kv_group_delete);
+
+	FFF_RESET_HISTORY();
+
+	sid_pal_storage_kv_record_get_fake.custom_fake = record_get;
+	sid_pal_storage_kv_record_set_fake.custom_fake = record_set;
+	sid_pal_storage_kv_group_delete_fake.custom_fake = group_delete;
+
+	memset(records, 0, sizeof(records));
+}
+
+ZTEST_SUITE(dfu_block_map, NULL, NULL, setup, NULL, NULL);
+
+ZTEST(dfu_block_map, test_open_new)
+{
+	zassert_equal(0, dfu_block_map_open(&map, 1, 10 * BLOCK + 1, BLOCK));
+	zassert_equal(11, map.block_count);
+	zassert_equal(0, map.received);
+	zassert_false(dfu_block_map_complete(&map));
+	zassert_equal(0, dfu_block_map_first_missing(&map));
+	zassert_equal(1, sid_pal_storage_kv_group_delete_fake.call_count);
+}
+
+ZTEST(dfu_block_map, test_open_invalid)
+{
+	zassert_equal(-EINVAL, dfu_block_map_open(NULL, 1, BLOCK, BLOCK));
+	zassert_equal(-EINVAL, dfu_block_map_open(&map, 1, 0, BLOCK));
+	zassert_equal(-EINVAL, dfu_block_map_open(&map, 1, BLOCK, 0));
+	zassert_equal(-EFBIG, dfu_block_map_open(&map, 1,
+						 CONFIG_SIDEWALK_FILE_TRANSFER_DFU_BITMAP_SIZE * 8 *
+							 BLOCK + 1,
+						 BLOCK));
+}
+
+ZTEST(dfu_block_map, test_out_of_order)
+{
+	zassert_equal(0, dfu_block_map_open(&map, 1, 4 * BLOCK, BLOCK));
+
+	zassert_equal(0, dfu_block_map_set(&map, 3 * BLOCK));
+	zassert_equal(0, dfu_block_map_set(&map, 1 * BLOCK));
+	zassert_true(dfu_block_map_test(&map, 3 * BLOCK));
+	zassert_false(dfu_block_map_test(&map, 2 * BLOCK));
+	zassert_equal(0, dfu_block_map_first_missing(&map));
+
+	/* a duplicate fragment is counted once */
+	zassert_equal(0, dfu_block_map_set(&map, 1 * BLOCK));
+	zassert_equal(2, map.received);
+
+	zassert_true(dfu_block_map_any(&map, 3 * BLOCK + 1, 4 * BLOCK));
+	zassert_false(dfu_block_map_any(&map, 2 * BLOCK, 3 * BLOCK));
+	zassert_false(dfu_block_map_any(&map, 0, BLOCK));
+
+	zassert_equal(-EINVAL, dfu_block_map_set(&map, BLOCK / 2));
+	zassert_equal(-EINVAL, dfu_block_map_set(&map, 4 * BLOCK));
+}
+
+ZTEST(dfu_block_map, test_complete_saves)
+{
+	zassert_equal(0, dfu_block_map_open(&map, 1, 3 * BLOCK - 10, BLOCK));
+	uint32_t header_writes = sid_pal_storage_kv_record_set_fake.call_count;
+
+	zassert_equal(0, dfu_block_map_set(&map, 2 * BLOCK));
+	zassert_equal(0, dfu_block_map_set(&map, 0));
+	zassert_equal(header_writes, sid_pal_storage_kv_record_set_fake.call_count);
+
+	zassert_equal(0, dfu_block_map_set(&map, BLOCK));
+	zassert_true(dfu_block_map_complete(&map));
+	zassert_equal(3 * BLOCK - 10, dfu_block_map_first_missing(&map));
+	zassert_equal(header_writes + 1, sid_pal_storage_kv_record_set_fake.call_count);
+	zassert_equal(0, map.dirty_chunks);
+}
+
+ZTEST(dfu_block_map, test_save_every_n_fragments)
+{
+	zassert_equal(0, dfu_block_map_open(&map, 1, 100 * BLOCK, BLOCK));
+	uint32_t writes = sid_pal_storage_kv_record_set_fake.call_count;
+
+	for (uint32_t i = 0; i < CONFIG_SIDEWALK_FILE_TRANSFER_DFU_SAVE_FRAGMENTS - 1; i++) {
+		zassert_equal(0, dfu_block_map_set(&map, i * BLOCK));
+	}
+	zassert_equal(writes, sid_pal_storage_kv_record_set_fake.call_count);
+
+	zassert_equal(0, dfu_block_map_set(&map, 99 * BLOCK));
+	zassert_equal(writes + 1, sid_pal_storage_kv_record_set_fake.call_count);
+	zassert_equal(0, map.blocks_since_save);
+}
+
+ZTEST(dfu_block_map, test_resume)
+{
+	zassert_equal(0, dfu_block_map_open(&map, 7, 300 * BLOCK, BLOCK));
+	zassert_equal(0, dfu_block_map_set(&map, 5 * BLOCK));
+	zassert_equal(0, dfu_block_map_set(&map, 290 * BLOCK));
+	zassert_equal(0, dfu_block_map_save(&map));
+
+	zassert_equal(1, dfu_block_map_open(&map, 7, 300 * BLOCK, BLOCK));
+	zassert_equal(2, map.received);
+	zassert_true(dfu_block_map_test(&map, 5 * BLOCK));
+	zassert_true(dfu_block_map_test(&map, 290 * BLOCK));
+	zassert_false(dfu_block_map_test(&map, 6 * BLOCK));
+}
+
+ZTEST(dfu_block_map, test_different_file_starts_over)
+{
+	zassert_equal(0, dfu_block_map_open(&map, 7, 30 * BLOCK, BLOCK));
+	zassert_equal(0, dfu_block_map_set(&map, 5 * BLOCK));
+	zassert_equal(0, dfu_block_map_save(&map));
+
+	zassert_equal(0, dfu_block_map_open(&map, 8, 30 * BLOCK, BLOCK));
+	zassert_equal(0, map.received);
+	zassert_equal(0, dfu_block_map_open(&map, 8, 31 * BLOCK, BLOCK));
+	zassert_equal(0, dfu_block_map_open(&map, 8, 31 * BLOCK, BLOCK / 2));
+	zassert_false(dfu_block_map_test(&map, 5 * BLOCK));
+}
+
+ZTEST(dfu_block_map, test_clear)
+{
+	zassert_equal(0, dfu_block_map_open(&map, 7, 30 * BLOCK, BLOCK));
+	zassert_equal(0, dfu_block_map_set(&map, 5 * BLOCK));
+	zassert_equal(0, dfu_block_map_save(&map));
+
+	dfu_block_map_clear(&map);
+	zassert_equal(0, map.block_count);
+	zassert_equal(0, dfu_block_map_open(&map, 7, 30 * BLOCK, BLOCK));
+}
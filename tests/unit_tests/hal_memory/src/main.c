@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_hal_memory_ifc.h>
+#include <sid_hal_memory_ext.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#define HEAP_CHUNK_SIZE 150
+
+static void *ptrs[32];
+static size_t ptrs_count;
+
+static void *alloc(size_t size)
+{
+	void *ptr = sid_hal_malloc(size);
+
+	if (ptr) {
+		zassert_true(ptrs_count < ARRAY_SIZE(ptrs));
+		ptrs[ptrs_count++] = ptr;
+		memset(ptr, 0xA5, size);
+	}
+	return ptr;
+}
+
+static struct sid_hal_memory_stats stats_get(void)
+{
+	struct sid_hal_memory_stats stats;
+
+	sid_hal_memory_stats_get(&stats);
+	return stats;
+}
+
+static void before(void *f)
+{
+	sid_hal_memory_stats_reset();
+}
+
+static void after(void *f)
+{
+	for (size_t i = 0; i < ptrs_count; i++) {
+		if (ptrs[i]) {
+			sid_hal_free(ptrs[i]);
+		}
+	}
+	ptrs_count = 0;
+}
+
+ZTEST_SUITE(hal_memory, NULL, NULL, before, after, NULL);
+
+ZTEST(hal_memory, test_smallest_class_used)
+{
+	zassert_not_null(alloc(1));
+	zassert_not_null(alloc(16));
+	zassert_not_null(alloc(17));
+	zassert_not_null(alloc(100));
+
+	struct sid_hal_memory_stats stats = stats_get();
+
+	zassert_equal(16, stats.pools[0].block_size);
+	zassert_equal(CONFIG_SIDEWALK_HEAP_POOL_1_BLOCKS, stats.pools[0].blocks);
+	zassert_equal(2, stats.pools[0].allocs);
+	zassert_equal(2, stats.pools[0].used);
+	zassert_equal(15, stats.pools[0].unused_bytes);
+	zassert_equal(1, stats.pools[1].allocs);
+	zassert_equal(0, stats.pools[2].allocs);
+	zassert_equal(1, stats.pools[3].allocs);
+	zassert_equal(0, stats.heap_allocs);
+}
+
+ZTEST(hal_memory, test_max_aligned)
+{
+	const size_t sizes[] = { 1, 5, 17, 33, 65, CONFIG_SIDEWALK_HEAP_POOL_4_BLOCK_SIZE + 3 };
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		void *ptr = alloc(sizes[i]);
+
+		zassert_not_null(ptr);
+		zassert_equal(0, (uintptr_t)ptr % __alignof__(max_align_t), "size %zu", sizes[i]);
+	}
+}
+
+ZTEST(hal_memory, test_large_to_heap)
+{
+	zassert_not_null(alloc(CONFIG_SIDEWALK_HEAP_POOL_4_BLOCK_SIZE + 1));
+
+	struct sid_hal_memory_stats stats = stats_get();
+
+	zassert_equal(1, stats.heap_allocs);
+	for (int i = 0; i < SID_HAL_MEMORY_POOLS; i++) {
+		zassert_equal(0, stats.pools[i].allocs);
+	}
+}
+
+ZTEST(hal_memory, test_full_class_to_heap)
+{
+	for (int i = 0; i < CONFIG_SIDEWALK_HEAP_POOL_1_BLOCKS + 1; i++) {
+		zassert_not_null(alloc(8));
+	}
+
+	struct sid_hal_memory_stats stats = stats_get();
+
+	zassert_equal(CONFIG_SIDEWALK_HEAP_POOL_1_BLOCKS, stats.pools[0].allocs);
+	zassert_equal(CONFIG_SIDEWALK_HEAP_POOL_1_BLOCKS, stats.pools[0].used_max);
+	zassert_equal(1, stats.pools[0].full);
+	zassert_equal(0, stats.pools[1].allocs);
+	zassert_equal(1, stats.heap_allocs);
+
+	/* blocks and the heap chunk are returned where they came from */
+	after(NULL);
+	stats = stats_get();
+	zassert_equal(0, stats.pools[0].used);
+	zassert_equal(CONFIG_SIDEWALK_HEAP_POOL_1_BLOCKS, stats.pools[0].used_max);
+	zassert_not_null(alloc(8));
+	zassert_equal(CONFIG_SIDEWALK_HEAP_POOL_1_BLOCKS + 1, stats_get().pools[0].allocs);
+}
+
+ZTEST(hal_memory, test_reset_keeps_usage)
+{
+	zassert_not_null(alloc(32));
+	zassert_not_null(alloc(32));
+	sid_hal_free(ptrs[--ptrs_count]);
+	sid_hal_memory_stats_reset();
+
+	struct sid_hal_memory_stats stats = stats_get();
+
+	zassert_equal(0, stats.pools[1].allocs);
+	zassert_equal(1, stats.pools[1].used);
+	zassert_equal(1, stats.pools[1].used_max);
+}
+
+ZTEST(hal_memory, test_heap_fragmented)
+{
+	while (alloc(HEAP_CHUNK_SIZE)) {
+	}
+	zassert_true(ptrs_count > 4);
+
+	/* every other chunk freed, no free space is large enough for two chunks */
+	for (size_t i = 0; i < ptrs_count - 1; i += 2) {
+		sid_hal_free(ptrs[i]);
+		ptrs[i] = NULL;
+	}
+	sid_hal_memory_stats_reset();
+
+	zassert_is_null(sid_hal_malloc(2 * HEAP_CHUNK_SIZE));
+
+	struct sid_hal_memory_stats stats = stats_get();
+
+	zassert_true(stats.heap_free >= 2 * HEAP_CHUNK_SIZE);
+	zassert_equal(1, stats.heap_failures);
+	zassert_equal(1, stats.heap_fragmented);
+}
@@ -740,3 +740,94 @@ ZTEST(real_case, test_valid_mfg_hex_v7_flash)
 			  empty_bytes_after_tlv_size);
 	sid_hal_free(empty_bytes);
 }
+
+static uint8_t two_block_storage[2 * CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE];
+static uint32_t erase_calls;
+static uint32_t write_calls;
+
+static int counting_erase(void *ctx, uint32_t offset, uint32_t size)
+{
+	erase_calls++;
+	return tlv_storage_ram_erase(ctx, offset, size);
+}
+
+static int counting_write(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_size)
+{
+	write_calls++;
+	return tlv_storage_ram_write(ctx, offset, data, data_size);
+}
+
+ZTEST(real_case, test_mfg_hex_v8_writes_changed_blocks)
+{
+	memset(two_block_storage, 0xff, sizeof(two_block_storage));
+	memcpy(two_block_storage, mfg_v8_bin_raw, mfg_v8_bin_len);
+	erase_calls = 0;
+	write_calls = 0;
+
+	tlv_ctx tlv = (tlv_ctx){ .start_offset = 0,
+				 .end_offset = sizeof(two_block_storage),
+				 .tlv_storage_start_marker_size = 8,
+				 .storage_impl = { .ctx = two_block_storage,
+						   .read = tlv_storage_ram_read,
+						   .erase = counting_erase,
+						   .write = counting_write } };
+
+	zassert_equal(parse_mfg_raw_tlv(&tlv), 0);
+	zassert_mem_equal(two_block_storage, expected_parsed_mfg, sizeof(expected_parsed_mfg));
+	/* the second block stays erased */
+	zassert_equal(erase_calls, 1);
+	zassert_equal(write_calls, 1);
+	for (size_t i = CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE; i < sizeof(two_block_storage); i++) {
+		zassert_equal(two_block_storage[i], 0xff);
+	}
+
+	/* storing the same image again writes nothing */
+	uint8_t *image = sid_hal_malloc(sizeof(two_block_storage));
+	zassert_not_null(image);
+	memcpy(image, two_block_storage, sizeof(two_block_storage));
+	uint32_t blocks_written = UINT32_MAX;
+	zassert_equal(mfg_store_image(&tlv, image, sizeof(two_block_storage), &blocks_written), 0);
+	zassert_equal(blocks_written, 0);
+	zassert_equal(erase_calls, 1);
+	sid_hal_free(image);
+}
+
+ZTEST(real_case, test_mfg_hex_v8_store_unaligned)
+{
+	memset(two_block_storage, 0xa5, sizeof(two_block_storage));
+	erase_calls = 0;
+	write_calls = 0;
+
+	tlv_ctx tlv = (tlv_ctx){ .start_offset = CONFIG_SIDEWALK_MFG_PARSER_BLOCK_SIZE / 2,
+				 .end_offset = sizeof(two_block_storage),
+				 .tlv_storage_start_marker_size = 8,
+				 .storage_impl = { .ctx = two_block_storage,
+						   .read = tlv_storage_ram_read,
+						   .erase = counting_erase,
+						   .write = counting_write } };
+	uint8_t image[16] = { 0 };
+	uint32_t blocks_written;
+
+	zassert_equal(mfg_store_image(&tlv, image, sizeof(image), &blocks_written), -EINVAL);
+	zassert_equal(erase_calls, 0);
+	zassert_equal(write_calls, 0);
+}
+
+ZTEST(real_case, test_mfg_hex_v8_invalid_element_size)
+{
+	memcpy(TLV_RAM_STORAGE, mfg_v8_bin_raw, 8);
+	/* SMSN longer than any mfg value */
+	memcpy(&TLV_RAM_STORAGE[8], (uint8_t[]){ 0x00, 0x04, 0x01, 0x00 }, 4);
+
+	tlv_ctx tlv = (tlv_ctx){ .start_offset = 0,
+				 .end_offset = sizeof(TLV_RAM_STORAGE),
+				 .tlv_storage_start_marker_size = 8,
+				 .storage_impl = { .ctx = TLV_RAM_STORAGE,
+						   .read = tlv_storage_ram_read,
+						   .erase = tlv_storage_ram_erase,
+						   .write = tlv_storage_ram_write } };
+
+	zassert_equal(parse_mfg_raw_tlv(&tlv), -EINVAL);
+	/* the raw data is left as it was */
+	zassert_mem_equal(TLV_RAM_STORAGE, mfg_v8_bin_raw, 8);
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_storage_backend.h>
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#define GROUP_A 0x10
+#define GROUP_B 0x11
+
+static void *backend_setup(void)
+{
+	zassert_equal(0, sid_storage_backend_init());
+	return NULL;
+}
+
+static void before(void *f)
+{
+	zassert_equal(0, sid_storage_backend_group_delete(GROUP_A));
+	zassert_equal(0, sid_storage_backend_group_delete(GROUP_B));
+}
+
+ZTEST_SUITE(pal_storage_backend, NULL, backend_setup, before, NULL, NULL);
+
+ZTEST(pal_storage_backend, test_write_read)
+{
+	const uint8_t value[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	uint8_t read[8] = { 0 };
+	uint32_t len = 0;
+
+	zassert_equal(-ENOENT, sid_storage_backend_read(GROUP_A, 1, read, sizeof(read)));
+	zassert_equal(-ENOENT, sid_storage_backend_len(GROUP_A, 1, &len));
+
+	zassert_equal(0, sid_storage_backend_write(GROUP_A, 1, value, sizeof(value)));
+	zassert_equal(0, sid_storage_backend_commit());
+	zassert_equal(0, sid_storage_backend_len(GROUP_A, 1, &len));
+	zassert_equal(sizeof(value), len);
+	zassert_equal(sizeof(read), sid_storage_backend_read(GROUP_A, 1, read, sizeof(read)));
+	zassert_mem_equal(value, read, sizeof(value));
+
+	/* a short buffer gets the beginning of the value */
+	memset(read, 0, sizeof(read));
+	zassert_equal(4, sid_storage_backend_read(GROUP_A, 1, read, 4));
+	zassert_mem_equal(value, read, 4);
+	zassert_equal(0, read[4]);
+}
+
+ZTEST(pal_storage_backend, test_delete_write_again)
+{
+	const uint32_t value = 0x11223344;
+	uint32_t read = 0;
+
+	zassert_equal(0, sid_storage_backend_write(GROUP_A, 2, &value, sizeof(value)));
+	zassert_equal(0, sid_storage_backend_delete(GROUP_A, 2));
+	zassert_equal(-ENOENT, sid_storage_backend_read(GROUP_A, 2, &read, sizeof(read)));
+	/* deleting a missing record is not an error */
+	zassert_equal(0, sid_storage_backend_delete(GROUP_A, 2));
+
+	zassert_equal(0, sid_storage_backend_write(GROUP_A, 2, &value, sizeof(value)));
+	zassert_equal(sizeof(read), sid_storage_backend_read(GROUP_A, 2, &read, sizeof(read)));
+	zassert_equal(value, read);
+}
+
+ZTEST(pal_storage_backend, test_group_delete)
+{
+	uint32_t read = 0;
+
+	for (uint32_t key = 0; key < 8; key++) {
+		zassert_equal(0, sid_storage_backend_write(GROUP_A, key, &key, sizeof(key)));
+		zassert_equal(0, sid_storage_backend_write(GROUP_B, key, &key, sizeof(key)));
+	}
+	zassert_equal(0, sid_storage_backend_commit());
+	zassert_equal(0, sid_storage_backend_group_delete(GROUP_A));
+
+	for (uint32_t key = 0; key < 8; key++) {
+		zassert_equal(-ENOENT, sid_storage_backend_read(GROUP_A, key, &read, sizeof(read)));
+		zassert_equal(sizeof(read), sid_storage_backend_read(GROUP_B, key, &read,
+								      sizeof(read)));
+		zassert_equal(key, read);
+	}
+
+	/* the group is usable after the delete */
+	zassert_equal(0, sid_storage_backend_write(GROUP_A, 3, &read, sizeof(read)));
+	zassert_equal(0, sid_storage_backend_group_delete(GROUP_A));
+	zassert_equal(-ENOENT, sid_storage_backend_read(GROUP_A, 3, &read, sizeof(read)));
+}
+
+ZTEST(pal_storage_backend, test_group_delete_back_to_back)
+{
+	uint32_t read = 0;
+
+	for (uint32_t key = 0; key < 4; key++) {
+		zassert_equal(0, sid_storage_backend_write(GROUP_A, key, &key, sizeof(key)));
+		zassert_equal(0, sid_storage_backend_write(GROUP_B, key, &key, sizeof(key)));
+	}
+	zassert_equal(0, sid_storage_backend_commit());
+
+	/* the second delete may have to finish the first one */
+	zassert_equal(0, sid_storage_backend_group_delete(GROUP_A));
+	zassert_equal(0, sid_storage_backend_group_delete(GROUP_A));
+	zassert_equal(0, sid_storage_backend_delete(GROUP_A, 1));
+	zassert_equal(0, sid_storage_backend_group_delete(GROUP_B));
+	for (uint32_t key = 0; key < 4; key++) {
+		zassert_equal(-ENOENT, sid_storage_backend_read(GROUP_A, key, &read, sizeof(read)));
+		zassert_equal(-ENOENT, sid_storage_backend_read(GROUP_B, key, &read, sizeof(read)));
+	}
+
+	zassert_equal(0, sid_storage_backend_write(GROUP_B, 1, &read, sizeof(read)));
+	zassert_equal(-ENOENT, sid_storage_backend_read(GROUP_A, 1, &read, sizeof(read)));
+	zassert_equal(sizeof(read), sid_storage_backend_read(GROUP_B, 1, &read, sizeof(read)));
+}
+
+ZTEST(pal_storage_backend, test_group_out_of_range)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SIDEWALK_STORAGE_KV_BACKEND_ZMS);
+
+	uint32_t value = 1;
+	uint32_t len;
+
+	zassert_equal(-EINVAL, sid_storage_backend_write(0x8000, 1, &value, sizeof(value)));
+	zassert_equal(-EINVAL, sid_storage_backend_read(0x8000, 1, &value, sizeof(value)));
+	zassert_equal(-EINVAL, sid_storage_backend_len(0x8000, 1, &len));
+	zassert_equal(-EINVAL, sid_storage_backend_delete(0x8000, 1));
+	zassert_equal(-EINVAL, sid_storage_backend_group_delete(0xffff));
+}
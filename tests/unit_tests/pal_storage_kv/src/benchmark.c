@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+#include <sid_storage_kv_ext.h>
+#endif
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/ztest.h>
+
+#define GROUP 3
+#define RECORDS 16
+#define ROUNDS 8
+
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_BACKEND_SETTINGS
+struct subtree_value {
+	void *dest;
+	size_t capacity;
+	int len;
+};
+
+/* Lookup of one value by walking its subtree, as done before settings_load_one() */
+static int subtree_loader(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg,
+			  void *param)
+{
+	struct subtree_value *value = param;
+
+	if (settings_name_next(name, NULL) != 0) {
+		return 0;
+	}
+	value->len = read_cb(cb_arg, value->dest, value->capacity);
+	return 0;
+}
+
+static int subtree_load(uint16_t group, uint16_t key, void *dest, size_t len)
+{
+	char serial[32];
+	struct subtree_value value = { .dest = dest, .capacity = len, .len = -ENOENT };
+
+	snprintf(serial, sizeof(serial), "sidewalk/storage/%04x/%04x", group, key);
+	int rc = settings_load_subtree_direct(serial, subtree_loader, &value);
+	return rc ? rc : value.len;
+}
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_BACKEND_SETTINGS */
+
+static uint32_t elapsed_us(uint32_t start, uint32_t ops)
+{
+	return k_cyc_to_us_floor32(k_cycle_get_32() - start) / ops;
+}
+
+ZTEST(pal_storage_benchmark, test_benchmark_get_set)
+{
+	uint32_t value;
+	uint32_t start;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+
+	start = k_cycle_get_32();
+	for (uint16_t key = 0; key < RECORDS; key++) {
+		value = key * 3;
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(GROUP, key, &value, sizeof(value)));
+	}
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+#endif
+	const uint32_t set_us = elapsed_us(start, RECORDS);
+
+	start = k_cycle_get_32();
+	for (int round = 0; round < ROUNDS; round++) {
+		for (uint16_t key = 0; key < RECORDS; key++) {
+			zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(
+							      GROUP, key, &value, sizeof(value)));
+			zassert_equal(key * 3, value);
+		}
+	}
+	const uint32_t get_us = elapsed_us(start, ROUNDS * RECORDS);
+
+	start = k_cycle_get_32();
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(GROUP));
+	const uint32_t group_delete_us = elapsed_us(start, 1);
+
+	TC_PRINT("%s backend, per record: set %u us, get %u us, group delete %u us\n",
+		 IS_ENABLED(CONFIG_SIDEWALK_STORAGE_KV_BACKEND_ZMS) ? "ZMS" : "settings", set_us,
+		 get_us, group_delete_us);
+	TC_PRINT("throughput: set %u records/s, get %u records/s\n", USEC_PER_SEC / MAX(set_us, 1),
+		 USEC_PER_SEC / MAX(get_us, 1));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(GROUP, 0, &value, sizeof(value)));
+}
+
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_BACKEND_SETTINGS
+ZTEST(pal_storage_benchmark, test_benchmark_subtree_walk)
+{
+	uint32_t value;
+	uint32_t start;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	for (uint16_t key = 0; key < RECORDS; key++) {
+		value = key * 3;
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(GROUP, key, &value, sizeof(value)));
+	}
+#ifdef CONFIG_SIDEWALK_STORAGE_KV_CACHE
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+#endif
+
+	start = k_cycle_get_32();
+	for (int round = 0; round < ROUNDS; round++) {
+		for (uint16_t key = 0; key < RECORDS; key++) {
+			zassert_equal(sizeof(value),
+				      subtree_load(GROUP, key, &value, sizeof(value)));
+			zassert_equal(key * 3, value);
+		}
+	}
+	TC_PRINT("per record: subtree walk %u us\n", elapsed_us(start, ROUNDS * RECORDS));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(GROUP));
+	zassert_equal(-ENOENT, subtree_load(GROUP, 0, &value, sizeof(value)));
+}
+#endif /* CONFIG_SIDEWALK_STORAGE_KV_BACKEND_SETTINGS */
+
+ZTEST_SUITE(pal_storage_benchmark, NULL, NULL, NULL, NULL, NULL);
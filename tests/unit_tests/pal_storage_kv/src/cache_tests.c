@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#include <sid_storage_kv_ext.h>
+#include <sid_storage_backend.h>
+
+#include <errno.h>
+#include <stdint.h>
+#include <zephyr/ztest.h>
+
+#define GROUP 7
+
+static void *cache_setup(void)
+{
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	return NULL;
+}
+
+static void before(void *f)
+{
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(GROUP));
+	sid_storage_kv_stats_reset();
+}
+
+ZTEST_SUITE(pal_storage_cache, NULL, cache_setup, before, NULL, NULL);
+
+/* Value in the flash, bypassing the cache */
+static int flash_value(uint16_t key, uint32_t *value)
+{
+	return sid_storage_backend_read(GROUP, key, value, sizeof(*value));
+}
+
+static struct sid_storage_kv_stats stats_get(void)
+{
+	struct sid_storage_kv_stats stats;
+
+	sid_storage_kv_stats_get(&stats);
+	return stats;
+}
+
+ZTEST(pal_storage_cache, test_set_deferred_until_flush)
+{
+	const uint32_t value = 0x1234;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 1, &value, sizeof(value)));
+	zassert_equal(-ENOENT, flash_value(1, &read));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(GROUP, 1, &read, sizeof(read)));
+	zassert_equal(value, read);
+
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+	zassert_equal(sizeof(read), flash_value(1, &read));
+	zassert_equal(value, read);
+	zassert_equal(1, stats_get().flash_writes);
+	zassert_equal(1, stats_get().commits);
+}
+
+ZTEST(pal_storage_cache, test_set_coalesced)
+{
+	uint32_t read = 0;
+
+	for (uint32_t value = 0; value < 10; value++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(GROUP, 2, &value, sizeof(value)));
+	}
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+
+	struct sid_storage_kv_stats stats = stats_get();
+	zassert_equal(10, stats.sets);
+	zassert_equal(9, stats.writes_avoided);
+	zassert_equal(1, stats.flash_writes);
+	zassert_equal(sizeof(read), flash_value(2, &read));
+	zassert_equal(9, read);
+}
+
+ZTEST(pal_storage_cache, test_set_unchanged_skipped)
+{
+	const uint32_t value = 42;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 3, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 3, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+
+	struct sid_storage_kv_stats stats = stats_get();
+	zassert_equal(1, stats.writes_avoided);
+	zassert_equal(1, stats.flash_writes);
+	zassert_equal(1, stats.commits);
+}
+
+ZTEST(pal_storage_cache, test_dirty_max_flushes)
+{
+	uint32_t read = 0;
+
+	for (uint16_t key = 0; key < CONFIG_SIDEWALK_STORAGE_KV_CACHE_DIRTY_MAX - 1; key++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(GROUP, key, &key, sizeof(key)));
+	}
+	zassert_equal(0, stats_get().flash_writes);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 100, &read, 1));
+	struct sid_storage_kv_stats stats = stats_get();
+	zassert_equal(CONFIG_SIDEWALK_STORAGE_KV_CACHE_DIRTY_MAX, stats.flash_writes);
+	zassert_equal(1, stats.commits);
+	zassert_equal(1, flash_value(100, &read));
+}
+
+ZTEST(pal_storage_cache, test_delete_deferred)
+{
+	const uint32_t value = 7;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 4, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_delete(GROUP, 4));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(GROUP, 4, &read, sizeof(read)));
+	zassert_equal(SID_ERROR_NOT_FOUND, sid_pal_storage_kv_record_get_len(GROUP, 4, &read));
+	zassert_equal(sizeof(read), flash_value(4, &read));
+
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+	zassert_equal(-ENOENT, flash_value(4, &read));
+	zassert_equal(1, stats_get().flash_deletes);
+}
+
+ZTEST(pal_storage_cache, test_read_through)
+{
+	const uint32_t value = 0xCAFE;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 5, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_storage_kv_flush());
+	/* forget the cached records, the group in the flash is left as is */
+	for (uint16_t key = 10; key < 10 + CONFIG_SIDEWALK_STORAGE_KV_CACHE_ENTRIES; key++) {
+		zassert_equal(SID_ERROR_NOT_FOUND,
+			      sid_pal_storage_kv_record_get(GROUP + 1, key, &read, sizeof(read)));
+	}
+	sid_storage_kv_stats_reset();
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(GROUP, 5, &read, sizeof(read)));
+	zassert_equal(value, read);
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(GROUP, 5, &read, sizeof(read)));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(GROUP, 6, &read, sizeof(read)));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(GROUP, 6, &read, sizeof(read)));
+
+	struct sid_storage_kv_stats stats = stats_get();
+	zassert_equal(2, stats.read_misses);
+	zassert_equal(2, stats.read_hits);
+}
+
+ZTEST(pal_storage_cache, test_flush_after_delay)
+{
+	const uint32_t value = 99;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 8, &value, sizeof(value)));
+	zassert_equal(-ENOENT, flash_value(8, &read));
+
+	k_sleep(K_MSEC(2 * CONFIG_SIDEWALK_STORAGE_KV_CACHE_FLUSH_DELAY_MS));
+	zassert_equal(sizeof(read), flash_value(8, &read));
+	zassert_equal(value, read);
+}
+
+ZTEST(pal_storage_cache, test_deinit_flushes)
+{
+	const uint32_t value = 1;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(GROUP, 9, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_deinit());
+	zassert_equal(sizeof(read), flash_value(9, &read));
+}
@@ -6,15 +6,33 @@
 
 #include <stdint.h>
 
+extern unsigned int test_time_compare_count;
+
 int test_enter_critical_call_count;
 int test_exit_critical_call_count;
+unsigned int test_critical_max_compares;
+
+static int critical_depth;
+static unsigned int critical_enter_compares;
 
 void __wrap_sid_pal_enter_critical_region(void)
 {
 	test_enter_critical_call_count++;
+
+	if (critical_depth++ == 0) {
+		critical_enter_compares = test_time_compare_count;
+	}
 }
 
 void __wrap_sid_pal_exit_critical_region(void)
 {
 	test_exit_critical_call_count++;
+
+	if (--critical_depth == 0) {
+		unsigned int compares = test_time_compare_count - critical_enter_compares;
+
+		if (compares > test_critical_max_compares) {
+			test_critical_max_compares = compares;
+		}
+	}
 }
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file benchmark.c
+ *  @brief Timer queue benchmark.
+ *
+ *  Critical section length is measured in alarm comparisons done while the Sidewalk
+ *  critical region is held, so the result does not depend on the simulated clock.
+ */
+
+#include <zephyr/ztest.h>
+
+#include <sid_pal_timer_ifc.h>
+#include <sid_time_ops.h>
+
+#define BENCH_TIMER_COUNT 1000
+#define BENCH_CANCEL_EVERY 3
+#define BENCH_BASE_SEC 1000
+#define BENCH_SPREAD_SEC 100
+#define BENCH_RBTREE_MAX_COMPARES 128
+
+extern unsigned int test_critical_max_compares;
+
+static sid_pal_timer_t bench_timers[BENCH_TIMER_COUNT];
+static struct sid_timespec bench_last_alarm;
+static int bench_fired_cnt;
+static int bench_last_index;
+static bool bench_order_ok;
+static uint32_t bench_seed;
+
+static uint32_t bench_rand(void)
+{
+	bench_seed = bench_seed * 1103515245U + 12345U;
+	return bench_seed >> 1;
+}
+
+static void bench_timer_cb(void *arg, sid_pal_timer_t *originator)
+{
+	ARG_UNUSED(arg);
+
+	if (originator->alarm.tv_sec < bench_last_alarm.tv_sec ||
+	    (originator->alarm.tv_sec == bench_last_alarm.tv_sec &&
+	     originator->alarm.tv_nsec < bench_last_alarm.tv_nsec)) {
+		bench_order_ok = false;
+	}
+	bench_last_alarm = originator->alarm;
+	bench_fired_cnt++;
+}
+
+/* Timers on the same alarm fire in the order they were armed, that is in array order */
+static void bench_same_alarm_cb(void *arg, sid_pal_timer_t *originator)
+{
+	ARG_UNUSED(arg);
+
+	int index = originator - bench_timers;
+
+	if (index <= bench_last_index) {
+		bench_order_ok = false;
+	}
+	bench_last_index = index;
+	bench_fired_cnt++;
+}
+
+static void bench_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bench_last_alarm = (struct sid_timespec){ 0 };
+	bench_fired_cnt = 0;
+	bench_last_index = -1;
+	bench_order_ok = true;
+	bench_seed = 1;
+}
+
+ZTEST_SUITE(pal_timer_benchmark, NULL, NULL, bench_before, NULL, NULL);
+
+ZTEST(pal_timer_benchmark, test_arm_cancel_fire_1k)
+{
+	unsigned int worst_arm, worst_cancel, worst_fire;
+	int cancelled_cnt = 0;
+
+	test_critical_max_compares = 0;
+	for (int i = 0; i < BENCH_TIMER_COUNT; i++) {
+		struct sid_timespec when = {
+			.tv_sec = BENCH_BASE_SEC + bench_rand() % BENCH_SPREAD_SEC,
+			.tv_nsec = bench_rand() % SID_TIME_NSEC_PER_SEC,
+		};
+		sid_pal_timer_prio_class_t type = (i % 2) ? SID_PAL_TIMER_PRIO_CLASS_LOWPOWER :
+							     SID_PAL_TIMER_PRIO_CLASS_PRECISE;
+
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_init(&bench_timers[i], bench_timer_cb, NULL));
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_arm(&bench_timers[i], type, &when, NULL));
+	}
+	worst_arm = test_critical_max_compares;
+
+	test_critical_max_compares = 0;
+	for (int i = 0; i < BENCH_TIMER_COUNT; i += BENCH_CANCEL_EVERY) {
+		zassert_equal(SID_ERROR_NONE, sid_pal_timer_cancel(&bench_timers[i]));
+		zassert_false(sid_pal_timer_is_armed(&bench_timers[i]));
+		cancelled_cnt++;
+	}
+	worst_cancel = test_critical_max_compares;
+
+	struct sid_timespec now = { .tv_sec = BENCH_BASE_SEC + BENCH_SPREAD_SEC + 1 };
+
+	test_critical_max_compares = 0;
+	sid_pal_timer_event_callback(NULL, &now);
+	worst_fire = test_critical_max_compares;
+
+	TC_PRINT("timers %d, worst critical section [compares]: arm %u, cancel %u, fire %u\n",
+		 BENCH_TIMER_COUNT, worst_arm, worst_cancel, worst_fire);
+
+	zassert_equal(BENCH_TIMER_COUNT - cancelled_cnt, bench_fired_cnt);
+	zassert_true(bench_order_ok);
+	for (int i = 0; i < BENCH_TIMER_COUNT; i++) {
+		zassert_false(sid_pal_timer_is_armed(&bench_timers[i]));
+		zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&bench_timers[i]));
+	}
+
+	if (IS_ENABLED(CONFIG_SIDEWALK_TIMER_QUEUE_RBTREE)) {
+		zassert_true(worst_arm <= BENCH_RBTREE_MAX_COMPARES);
+		zassert_true(worst_cancel <= BENCH_RBTREE_MAX_COMPARES);
+		zassert_true(worst_fire <= BENCH_RBTREE_MAX_COMPARES);
+	}
+}
+
+ZTEST(pal_timer_benchmark, test_arm_cancel_fire_same_alarm_1k)
+{
+	struct sid_timespec when = { .tv_sec = BENCH_BASE_SEC };
+	unsigned int worst_arm, worst_cancel, worst_fire;
+	int cancelled_cnt = 0;
+
+	test_critical_max_compares = 0;
+	for (int i = 0; i < BENCH_TIMER_COUNT; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_init(&bench_timers[i], bench_same_alarm_cb, NULL));
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_arm(&bench_timers[i], SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+						&when, NULL));
+	}
+	worst_arm = test_critical_max_compares;
+
+	test_critical_max_compares = 0;
+	for (int i = 0; i < BENCH_TIMER_COUNT; i += BENCH_CANCEL_EVERY) {
+		zassert_equal(SID_ERROR_NONE, sid_pal_timer_cancel(&bench_timers[i]));
+		zassert_false(sid_pal_timer_is_armed(&bench_timers[i]));
+		cancelled_cnt++;
+	}
+	worst_cancel = test_critical_max_compares;
+
+	test_critical_max_compares = 0;
+	sid_pal_timer_event_callback(NULL, &when);
+	worst_fire = test_critical_max_compares;
+
+	TC_PRINT("timers %d on one alarm, worst critical section [compares]: arm %u, cancel %u, "
+		 "fire %u\n",
+		 BENCH_TIMER_COUNT, worst_arm, worst_cancel, worst_fire);
+
+	zassert_equal(BENCH_TIMER_COUNT - cancelled_cnt, bench_fired_cnt);
+	zassert_true(bench_order_ok);
+	for (int i = 0; i < BENCH_TIMER_COUNT; i++) {
+		zassert_false(sid_pal_timer_is_armed(&bench_timers[i]));
+		zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&bench_timers[i]));
+	}
+
+	if (IS_ENABLED(CONFIG_SIDEWALK_TIMER_QUEUE_RBTREE)) {
+		zassert_true(worst_arm <= BENCH_RBTREE_MAX_COMPARES);
+		zassert_true(worst_cancel <= BENCH_RBTREE_MAX_COMPARES);
+		zassert_true(worst_fire <= BENCH_RBTREE_MAX_COMPARES);
+	}
+}
@@ -7,6 +7,9 @@
 
 #include <sid_pal_timer_ifc.h>
 #include <sid_pal_critical_region_ifc.h>
+#include <sid_pal_uptime_ifc.h>
+#include <sid_time_ops.h>
+#include <sid_timer_ext.h>
 
 extern int test_enter_critical_call_count;
 extern int test_exit_critical_call_count;
@@ -14,15 +17,20 @@ extern int test_exit_critical_call_count;
 static sid_pal_timer_t *p_null_timer = NULL;
 static sid_pal_timer_t test_timer;
 static sid_pal_timer_t test_timer_2;
+static sid_pal_timer_t test_timer_3;
 static int test_timer_arg;
 
 static int timer_callback_cnt = 0;
+static bool timer_callback_in_isr;
 
 static void before_test(void *fixture)
 {
 	ARG_UNUSED(fixture);
 
+	sid_timer_stats_reset();
+	sid_timer_latency_stats_reset();
 	timer_callback_cnt = 0;
+	timer_callback_in_isr = false;
 	test_enter_critical_call_count = 0;
 	test_exit_critical_call_count = 0;
 }
@@ -35,6 +43,7 @@ static void timer_cb(void *arg, sid_pal_timer_t *originator)
 	ARG_UNUSED(originator);
 
 	timer_callback_cnt++;
+	timer_callback_in_isr |= k_is_in_isr();
 }
 
 static void timer_init(void)
@@ -233,3 +242,255 @@ ZTEST(pal_timer, test_sid_pal_timer_two_timers)
 	zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
 	timer_deinit();
 }
+
+static sid_pal_timer_t *timer_fired_order[3];
+
+static void timer_order_cb(void *arg, sid_pal_timer_t *originator)
+{
+	ARG_UNUSED(arg);
+
+	if (timer_callback_cnt < ARRAY_SIZE(timer_fired_order)) {
+		timer_fired_order[timer_callback_cnt] = originator;
+	}
+	timer_callback_cnt++;
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_equal_alarms_fifo)
+{
+	struct sid_timespec when = { .tv_sec = 1 };
+	sid_pal_timer_t *armed_order[] = { &test_timer_2, &test_timer_3, &test_timer };
+
+	for (int i = 0; i < ARRAY_SIZE(armed_order); i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_init(armed_order[i], timer_order_cb, NULL));
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_arm(armed_order[i], SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+						&when, NULL));
+	}
+
+	sid_pal_timer_event_callback(NULL, &when);
+
+	zassert_equal(ARRAY_SIZE(armed_order), timer_callback_cnt);
+	for (int i = 0; i < ARRAY_SIZE(armed_order); i++) {
+		zassert_equal_ptr(armed_order[i], timer_fired_order[i]);
+		zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(armed_order[i]));
+	}
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_equal_alarms_rearm_last)
+{
+	struct sid_timespec when = { .tv_sec = 1 };
+	sid_pal_timer_t *armed_order[] = { &test_timer, &test_timer_2, &test_timer_3 };
+	sid_pal_timer_t *fired_order[] = { &test_timer, &test_timer_3, &test_timer_2 };
+
+	for (int i = 0; i < ARRAY_SIZE(armed_order); i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_init(armed_order[i], timer_order_cb, NULL));
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_arm(armed_order[i], SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+						&when, NULL));
+	}
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_cancel(&test_timer_2));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_arm(&test_timer_2,
+							SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when,
+							NULL));
+
+	sid_pal_timer_event_callback(NULL, &when);
+
+	zassert_equal(ARRAY_SIZE(fired_order), timer_callback_cnt);
+	for (int i = 0; i < ARRAY_SIZE(fired_order); i++) {
+		zassert_equal_ptr(fired_order[i], timer_fired_order[i]);
+		zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(fired_order[i]));
+	}
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_lowpower_coalesced)
+{
+	struct sid_timespec when_precise = { .tv_sec = 1, .tv_nsec = 500 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec when_lowpower = { .tv_sec = 1 };
+	struct sid_timer_stats stats;
+
+	timer_init();
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer_2, SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+					&when_precise, NULL));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_LOWPOWER,
+					&when_lowpower, NULL));
+
+	zassert_equal(when_precise.tv_sec, test_timer.alarm.tv_sec);
+	zassert_equal(when_precise.tv_nsec, test_timer.alarm.tv_nsec);
+	sid_timer_stats_get(&stats);
+	zassert_equal(2, stats.armed);
+	zassert_equal(1, stats.coalesced);
+	zassert_equal(1, stats.reprograms_avoided);
+
+	sid_pal_timer_event_callback(NULL, &when_precise);
+
+	zassert_equal(2, timer_callback_cnt);
+	sid_timer_stats_get(&stats);
+	zassert_equal(1, stats.wakeups);
+	zassert_equal(2, stats.expired);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_slack_expires_early)
+{
+	struct sid_timespec when_late = { .tv_sec = 2 };
+	struct sid_timespec when_slack = { .tv_sec = 1, .tv_nsec = 500 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec when_wakeup = { .tv_sec = 1, .tv_nsec = 700 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec slack = { .tv_sec = 1 };
+	struct sid_timer_stats stats;
+
+	timer_init();
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_init(&test_timer_3, timer_cb, &test_timer_arg));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer_2, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when_late,
+					NULL));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm_with_slack(&test_timer, &when_slack, NULL, &slack));
+	zassert_equal(when_late.tv_sec, test_timer.alarm.tv_sec);
+	zassert_equal(when_late.tv_nsec, test_timer.alarm.tv_nsec);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer_3, SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+					&when_wakeup, NULL));
+
+	sid_pal_timer_event_callback(NULL, &when_wakeup);
+
+	zassert_equal(2, timer_callback_cnt);
+	zassert_false(sid_pal_timer_is_armed(&test_timer));
+	zassert_true(sid_pal_timer_is_armed(&test_timer_2));
+	zassert_false(sid_pal_timer_is_armed(&test_timer_3));
+	sid_timer_stats_get(&stats);
+	zassert_equal(1, stats.expired_early);
+
+	sid_pal_timer_event_callback(NULL, &when_late);
+
+	zassert_equal(3, timer_callback_cnt);
+	zassert_false(sid_pal_timer_is_armed(&test_timer_2));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_3));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_slack_invalid_args)
+{
+	struct sid_timespec when = { .tv_sec = 5 };
+	struct sid_timespec slack = { .tv_nsec = SID_TIME_NSEC_PER_SEC };
+
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_timer_arm_with_slack(p_null_timer, &when, NULL, NULL));
+	timer_init();
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_timer_arm_with_slack(&test_timer, NULL, NULL, NULL));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_timer_arm_with_slack(&test_timer, &when, NULL, &slack));
+	zassert_false(sid_pal_timer_is_armed(&test_timer));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_arm_with_slack(&test_timer, &when, NULL, NULL));
+	zassert_true(sid_pal_timer_is_armed(&test_timer));
+	timer_deinit();
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_latency_stats)
+{
+	struct sid_timespec when = { .tv_sec = 1 };
+	struct sid_timespec now = { .tv_sec = 1, .tv_nsec = 300 * SID_TIME_NSEC_PER_USEC };
+	struct sid_timer_latency_stats stats;
+
+	timer_init();
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when,
+					NULL));
+
+	sid_pal_timer_event_callback(NULL, &now);
+
+	zassert_equal(1, timer_callback_cnt);
+	sid_timer_latency_stats_get(&stats);
+	/* 300 us falls into [256, 512) us */
+	zassert_equal(1, stats.fire_delay[9]);
+	zassert_equal(300, stats.fire_delay_max_us);
+	timer_deinit();
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_deferred_dispatch)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SIDEWALK_TIMER_DEFERRED);
+
+	const struct sid_timespec delay = { .tv_nsec = 10 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec when;
+	struct sid_timer_latency_stats stats;
+	uint32_t dispatched = 0;
+
+	timer_init();
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_init(&test_timer_3, timer_cb, &test_timer_arg));
+	zassert_equal(SID_ERROR_NONE, sid_pal_uptime_now(&when));
+	sid_time_add(&when, &delay);
+
+	/* More timers than the ready ring of the test configuration holds */
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when,
+					NULL));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_arm(&test_timer_2,
+							SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when,
+							NULL));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_arm(&test_timer_3,
+							SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when,
+							NULL));
+	k_sleep(K_MSEC(50));
+
+	zassert_equal(3, timer_callback_cnt);
+	zassert_false(timer_callback_in_isr);
+	sid_timer_latency_stats_get(&stats);
+	for (int i = 0; i < SID_TIMER_LATENCY_BUCKETS; i++) {
+		dispatched += stats.dispatch_delay[i];
+	}
+	zassert_equal(3, dispatched);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_3));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+}
+
+ZTEST(pal_timer, test_sid_pal_timer_deferred_rearm_before_dispatch)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SIDEWALK_TIMER_DEFERRED);
+
+	const struct sid_timespec delay = { .tv_nsec = 10 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec when;
+
+	timer_init();
+	zassert_equal(SID_ERROR_NONE, sid_pal_uptime_now(&when));
+	sid_time_add(&when, &delay);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when,
+					NULL));
+
+	/* The timer expires and waits in the ready ring, the worker cannot run yet */
+	k_sched_lock();
+	k_busy_wait(20 * USEC_PER_MSEC);
+	zassert_false(sid_pal_timer_is_armed(&test_timer));
+
+	sid_time_add(&when, &delay);
+	sid_time_add(&when, &delay);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when,
+					NULL));
+	k_sched_unlock();
+
+	/* The callback of the first alarm was dropped by the new one */
+	k_sleep(K_MSEC(5));
+	zassert_equal(0, timer_callback_cnt);
+	zassert_true(sid_pal_timer_is_armed(&test_timer));
+
+	k_sleep(K_MSEC(20));
+	zassert_equal(1, timer_callback_cnt);
+	zassert_false(sid_pal_timer_is_armed(&test_timer));
+
+	timer_deinit();
+}
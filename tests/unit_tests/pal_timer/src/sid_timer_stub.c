@@ -11,6 +11,9 @@
 #include <sid_time_types.h>
 #include <sid_time_ops.h>
 
+/* Number of alarm comparisons, used as a platform independent cost measure */
+unsigned int test_time_compare_count;
+
 void sid_time_normalize(struct sid_timespec *time)
 {
 	if (SID_TIME_NSEC_PER_SEC > time->tv_nsec) {
@@ -50,6 +53,8 @@ void sid_time_sub(struct sid_timespec *time_1, const struct sid_timespec *time_2
 
 bool sid_time_gt(const struct sid_timespec *time_1, const struct sid_timespec *time_2)
 {
+	test_time_compare_count++;
+
 	if ((time_1->tv_sec > time_2->tv_sec) ||
 	    (time_1->tv_sec == time_2->tv_sec && time_1->tv_nsec > time_2->tv_nsec)) {
 		return true;
@@ -5,8 +5,11 @@
  */
 #include <zephyr/ztest.h>
 #include <sid_pal_uptime_ifc.h>
+#include <sid_uptime_ext.h>
 #include <zephyr/sys_clock.h>
 
+#define TEST_XTAL_MAX_PPM 500
+
 extern uint64_t test_zephyr_uptime_ns_value;
 
 static void before_test(void *fixture)
@@ -32,6 +35,18 @@ static void uptime_test_time(uint64_t uptime_nanoseconds)
 	zassert_equal(nanoseconds, sid_time.tv_nsec);
 }
 
+static void uptime_test_elapsed(uint64_t kernel_elapsed_ns, uint64_t expected_elapsed_ns)
+{
+	struct sid_timespec start, end;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_uptime_now(&start));
+	test_zephyr_uptime_ns_value += kernel_elapsed_ns;
+	zassert_equal(SID_ERROR_NONE, sid_pal_uptime_now(&end));
+
+	zassert_equal(expected_elapsed_ns, ((uint64_t)end.tv_sec - start.tv_sec) * NSEC_PER_SEC +
+						   end.tv_nsec - start.tv_nsec);
+}
+
 ZTEST(pal_uptime, test_sid_pal_uptime_get_now)
 {
 	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_uptime_now(NULL));
@@ -49,6 +64,75 @@ ZTEST(pal_uptime, test_sid_pal_uptime_accuracy)
 	int16_t ppm;
 
 	ppm = sid_pal_uptime_get_xtal_ppm();
-	sid_pal_uptime_set_xtal_ppm(ppm);
+	zassert_equal(TEST_XTAL_MAX_PPM, ppm);
+
+	sid_pal_uptime_set_xtal_ppm(TEST_XTAL_MAX_PPM + 1);
 	zassert_equal(ppm, sid_pal_uptime_get_xtal_ppm());
+
+	sid_pal_uptime_set_xtal_ppm(ppm);
+	zassert_equal(CONFIG_SIDEWALK_UPTIME_COMPENSATED_PPM, sid_pal_uptime_get_xtal_ppm());
+
+	/* Uptime equals kernel uptime again for the following tests */
+	sid_pal_uptime_set_xtal_ppm(0);
+	uptime_test_time(1ull * NSEC_PER_SEC + 10ull);
+}
+
+ZTEST(pal_uptime, test_sid_pal_uptime_xtal_compensation)
+{
+	struct sid_timespec uptime;
+	struct sid_timespec kernel;
+
+	/* Crystal 100 ppm fast */
+	sid_pal_uptime_set_xtal_ppm(100);
+	test_zephyr_uptime_ns_value = 1000ull * NSEC_PER_SEC;
+	zassert_equal(SID_ERROR_NONE, sid_pal_uptime_now(&uptime));
+	zassert_equal(999, uptime.tv_sec);
+	zassert_equal(900 * NSEC_PER_MSEC, uptime.tv_nsec);
+
+	sid_uptime_to_kernel(&uptime, &kernel);
+	zassert_equal(1000, kernel.tv_sec);
+	zassert_equal(0, kernel.tv_nsec);
+	uptime.tv_nsec++;
+	sid_uptime_to_kernel(&uptime, &kernel);
+	zassert_equal(1000, kernel.tv_sec);
+	zassert_equal(2, kernel.tv_nsec);
+
+	/* New offset applies from now on, uptime does not jump */
+	sid_pal_uptime_set_xtal_ppm(-100);
+	zassert_equal(SID_ERROR_NONE, sid_pal_uptime_now(&uptime));
+	zassert_equal(999, uptime.tv_sec);
+	zassert_equal(900 * NSEC_PER_MSEC, uptime.tv_nsec);
+
+	test_zephyr_uptime_ns_value = 2000ull * NSEC_PER_SEC;
+	zassert_equal(SID_ERROR_NONE, sid_pal_uptime_now(&uptime));
+	zassert_equal(2000, uptime.tv_sec);
+	zassert_equal(0, uptime.tv_nsec);
+	zassert_equal(CONFIG_SIDEWALK_UPTIME_COMPENSATED_PPM, sid_pal_uptime_get_xtal_ppm());
+}
+
+ZTEST(pal_uptime, test_sid_pal_uptime_xtal_learning)
+{
+	const uint64_t start_ns = 10000ull * NSEC_PER_SEC;
+	struct sid_timespec reference = { .tv_sec = 50000 };
+
+	test_zephyr_uptime_ns_value = start_ns;
+	sid_pal_uptime_set_xtal_ppm(0);
+	sid_uptime_sync(&reference);
+
+	/* Too short interval is ignored */
+	test_zephyr_uptime_ns_value += 10ull * NSEC_PER_SEC;
+	reference.tv_sec += 10;
+	sid_uptime_sync(&reference);
+
+	/* Crystal 40 ppm fast, a quarter of the measurement is applied */
+	test_zephyr_uptime_ns_value = start_ns + 1000ull * NSEC_PER_SEC + 40 * NSEC_PER_MSEC;
+	reference.tv_sec += 990;
+	sid_uptime_sync(&reference);
+
+	uptime_test_elapsed(1000ull * NSEC_PER_SEC, 999990ull * NSEC_PER_MSEC);
+
+	/* Measurement beyond the crystal accuracy is ignored */
+	reference.tv_sec += 1000 - 1;
+	sid_uptime_sync(&reference);
+	uptime_test_elapsed(1000ull * NSEC_PER_SEC, 999990ull * NSEC_PER_MSEC);
 }
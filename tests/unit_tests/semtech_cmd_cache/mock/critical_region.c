@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_critical_region_ifc.h>
+
+void sid_pal_enter_critical_region(void)
+{
+}
+
+void sid_pal_exit_critical_region(void)
+{
+}
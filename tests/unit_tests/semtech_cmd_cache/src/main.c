@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <semtech_cmd_cache.h>
+
+#include <zephyr/ztest.h>
+
+static struct semtech_cmd_cache cache;
+
+static void setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	semtech_cmd_cache_init(&cache);
+}
+
+ZTEST_SUITE(semtech_cmd_cache, NULL, NULL, setup, NULL, NULL);
+
+static void assert_stats(uint32_t hits, uint32_t misses, uint32_t invalidations)
+{
+	struct semtech_cmd_cache_stats stats;
+
+	semtech_cmd_cache_stats_get(&stats);
+	zassert_equal(stats.hits, hits);
+	zassert_equal(stats.misses, misses);
+	zassert_equal(stats.invalidations, invalidations);
+}
+
+ZTEST(semtech_cmd_cache, test_unknown_is_miss)
+{
+	const uint8_t freq[] = { 0x36, 0x41, 0x99, 0x9A };
+
+	zassert_false(semtech_cmd_cache_hit(&cache, 0, freq, sizeof(freq)));
+	assert_stats(0, 1, 0);
+}
+
+ZTEST(semtech_cmd_cache, test_repeat_is_hit)
+{
+	const uint8_t freq[] = { 0x36, 0x41, 0x99, 0x9A };
+
+	zassert_false(semtech_cmd_cache_hit(&cache, 1, freq, sizeof(freq)));
+	semtech_cmd_cache_store(&cache, 1, freq, sizeof(freq));
+	zassert_true(semtech_cmd_cache_hit(&cache, 1, freq, sizeof(freq)));
+	zassert_true(semtech_cmd_cache_hit(&cache, 1, freq, sizeof(freq)));
+	assert_stats(2, 1, 0);
+}
+
+ZTEST(semtech_cmd_cache, test_change_is_miss)
+{
+	const uint8_t freq_a[] = { 0x36, 0x41, 0x99, 0x9A };
+	const uint8_t freq_b[] = { 0x36, 0x42, 0x00, 0x00 };
+
+	semtech_cmd_cache_store(&cache, 1, freq_a, sizeof(freq_a));
+	zassert_false(semtech_cmd_cache_hit(&cache, 1, freq_b, sizeof(freq_b)));
+	/* A shorter command is a different configuration too */
+	zassert_false(semtech_cmd_cache_hit(&cache, 1, freq_a, sizeof(freq_a) - 1));
+	/* Entries are independent */
+	zassert_false(semtech_cmd_cache_hit(&cache, 2, freq_a, sizeof(freq_a)));
+	assert_stats(0, 3, 0);
+}
+
+ZTEST(semtech_cmd_cache, test_invalidate)
+{
+	const uint8_t pkt_type[] = { 0x01 };
+	const uint8_t irq[] = { 0x02, 0x43, 0x02, 0x43, 0x00, 0x00, 0x00, 0x00 };
+
+	semtech_cmd_cache_store(&cache, 0, irq, sizeof(irq));
+	semtech_cmd_cache_store(&cache, 2, pkt_type, sizeof(pkt_type));
+	semtech_cmd_cache_invalidate(&cache);
+
+	zassert_false(semtech_cmd_cache_hit(&cache, 0, irq, sizeof(irq)));
+	zassert_false(semtech_cmd_cache_hit(&cache, 2, pkt_type, sizeof(pkt_type)));
+	assert_stats(0, 2, 1);
+}
+
+ZTEST(semtech_cmd_cache, test_too_long_not_stored)
+{
+	uint8_t params[SEMTECH_CMD_CACHE_PARAMS_MAX + 1] = { 0 };
+
+	semtech_cmd_cache_store(&cache, 3, params, SEMTECH_CMD_CACHE_PARAMS_MAX);
+	zassert_true(semtech_cmd_cache_hit(&cache, 3, params, SEMTECH_CMD_CACHE_PARAMS_MAX));
+
+	/* The entry is dropped, not truncated */
+	semtech_cmd_cache_store(&cache, 3, params, sizeof(params));
+	zassert_false(semtech_cmd_cache_hit(&cache, 3, params, SEMTECH_CMD_CACHE_PARAMS_MAX));
+	zassert_false(semtech_cmd_cache_hit(&cache, 3, params, sizeof(params)));
+}
+
+ZTEST(semtech_cmd_cache, test_stats_reset)
+{
+	const uint8_t tx_params[] = { 0x0E, 0x04 };
+
+	semtech_cmd_cache_store(&cache, 4, tx_params, sizeof(tx_params));
+	zassert_true(semtech_cmd_cache_hit(&cache, 4, tx_params, sizeof(tx_params)));
+	semtech_cmd_cache_invalidate(&cache);
+	assert_stats(1, 0, 1);
+
+	semtech_cmd_cache_stats_reset();
+	assert_stats(0, 0, 0);
+}
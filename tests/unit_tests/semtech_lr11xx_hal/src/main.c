@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <halo_lr11xx_radio.h>
+#include <lr11xx_hal.h>
+#include <semtech_busy_wait.h>
+#include <sid_pal_delay_ifc.h>
+#include <sid_serial_bus_ext.h>
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_set_direction, uint32_t, sid_pal_gpio_direction_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_output_mode, uint32_t, sid_pal_gpio_output_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_read, uint32_t, uint8_t *);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_write, uint32_t, uint8_t);
+FAKE_VOID_FUNC(sid_pal_delay_us, uint32_t);
+FAKE_VALUE_FUNC(sid_error_t, semtech_busy_wait, uint32_t, uint16_t, uint32_t);
+FAKE_VALUE_FUNC(bool, sid_pal_serial_bus_buf_in_ram, const void *, size_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_serial_bus_xfer_v, const struct sid_pal_serial_bus_iface *,
+		const struct sid_pal_serial_bus_client *, const struct sid_pal_serial_bus_buf *,
+		size_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_serial_bus_xfer_v_async,
+		const struct sid_pal_serial_bus_iface *, const struct sid_pal_serial_bus_client *,
+		const struct sid_pal_serial_bus_buf *, size_t, sid_pal_serial_bus_done_t, void *);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_serial_bus_flush, const struct sid_pal_serial_bus_iface *);
+
+#define FFF_FAKES_LIST(FAKE)                                                                       \
+	FAKE(sid_pal_gpio_set_direction)                                                           \
+	FAKE(sid_pal_gpio_output_mode)                                                             \
+	FAKE(sid_pal_gpio_read)                                                                    \
+	FAKE(sid_pal_gpio_write)                                                                   \
+	FAKE(sid_pal_delay_us)                                                                     \
+	FAKE(semtech_busy_wait)                                                                    \
+	FAKE(sid_pal_serial_bus_buf_in_ram)                                                        \
+	FAKE(sid_pal_serial_bus_xfer_v)                                                            \
+	FAKE(sid_pal_serial_bus_xfer_v_async)                                                      \
+	FAKE(sid_pal_serial_bus_flush)
+
+#define SET_RF_FREQUENCY 0x020B
+#define SET_PACKET_TYPE 0x020E
+#define SET_MODULATION_PARAMS 0x020F
+#define SET_PACKET_PARAMS 0x0210
+#define SET_TX_PARAMS 0x0211
+#define SET_PA_CONFIG 0x0215
+#define GET_STATUS 0x0100
+#define WRITE_BUFFER8 0x0109
+/* Marks a response read with lr11xx_hal_direct_read */
+#define DIRECT_READ 0x0000
+/* Marks the end of a write started without waiting for it */
+#define ASYNC_FLUSH 0xFFFF
+/* Marks a change of the NSS line driven as a GPIO */
+#define NSS_WRITE 0xFFFE
+
+#define PARAMS_MAX 16
+
+/* stat1 with the command status OK */
+#define STAT1_OK (LR11XX_SYSTEM_CMD_STATUS_OK << 1)
+
+/* Command sent on the bus */
+struct bus_cmd {
+	uint16_t opcode;
+	uint8_t params[PARAMS_MAX];
+	size_t length;
+};
+
+static struct bus_cmd bus_log[16];
+static size_t bus_log_count;
+
+static sid_error_t bus_xfer(const struct sid_pal_serial_bus_iface *iface,
+			    const struct sid_pal_serial_bus_client *client, uint8_t *tx,
+			    uint8_t *rx, size_t xfer_size)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(client);
+	ARG_UNUSED(tx);
+
+	memset(rx, 0, xfer_size);
+	rx[0] = STAT1_OK;
+	zassert_true(bus_log_count < ARRAY_SIZE(bus_log));
+	bus_log[bus_log_count++] = (struct bus_cmd){ .opcode = DIRECT_READ };
+
+	return SID_ERROR_NONE;
+}
+
+static const struct sid_pal_serial_bus_iface bus_iface = {
+	.xfer = bus_xfer,
+};
+
+static sid_error_t bus_xfer_v(const struct sid_pal_serial_bus_iface *iface,
+			      const struct sid_pal_serial_bus_client *client,
+			      const struct sid_pal_serial_bus_buf *bufs, size_t count)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(client);
+
+	if (bufs[0].rx) {
+		memset(bufs[0].rx, 0, bufs[0].len);
+		bufs[0].rx[0] = STAT1_OK;
+	}
+
+	/* The response of a read starts with a single NOP byte */
+	if (bufs[0].len < 2) {
+		return SID_ERROR_NONE;
+	}
+
+	struct bus_cmd cmd = { .opcode = (bufs[0].tx[0] << 8) | bufs[0].tx[1] };
+
+	if (count > 1) {
+		zassert_true(bufs[1].len <= sizeof(cmd.params));
+		memcpy(cmd.params, bufs[1].tx, bufs[1].len);
+		cmd.length = bufs[1].len;
+	}
+	zassert_true(bus_log_count < ARRAY_SIZE(bus_log));
+	bus_log[bus_log_count++] = cmd;
+
+	return SID_ERROR_NONE;
+}
+
+static sid_error_t bus_xfer_v_async(const struct sid_pal_serial_bus_iface *iface,
+				    const struct sid_pal_serial_bus_client *client,
+				    const struct sid_pal_serial_bus_buf *bufs, size_t count,
+				    sid_pal_serial_bus_done_t done, void *user_data)
+{
+	ARG_UNUSED(done);
+	ARG_UNUSED(user_data);
+
+	/* Logged when the write starts, it ends with sid_pal_serial_bus_flush() */
+	return bus_xfer_v(iface, client, bufs, count);
+}
+
+static sid_error_t bus_flush(const struct sid_pal_serial_bus_iface *iface)
+{
+	ARG_UNUSED(iface);
+
+	zassert_true(bus_log_count < ARRAY_SIZE(bus_log));
+	bus_log[bus_log_count++] = (struct bus_cmd){ .opcode = ASYNC_FLUSH };
+
+	return SID_ERROR_NONE;
+}
+
+static sid_error_t nss_write(uint32_t gpio_number, uint8_t value)
+{
+	ARG_UNUSED(gpio_number);
+	ARG_UNUSED(value);
+
+	zassert_true(bus_log_count < ARRAY_SIZE(bus_log));
+	bus_log[bus_log_count++] = (struct bus_cmd){ .opcode = NSS_WRITE };
+
+	return SID_ERROR_NONE;
+}
+
+static uint8_t internal_buffer[64];
+static radio_lr11xx_device_config_t config = {
+	.internal_buffer = {
+		.p = internal_buffer,
+		.size = sizeof(internal_buffer),
+	},
+};
+static halo_drv_semtech_ctx_t ctx;
+
+static void setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	FFF_FAKES_LIST(RESET_FAKE);
+	FFF_RESET_HISTORY();
+	sid_pal_serial_bus_xfer_v_fake.custom_fake = bus_xfer_v;
+	sid_pal_serial_bus_xfer_v_async_fake.custom_fake = bus_xfer_v_async;
+	sid_pal_serial_bus_flush_fake.custom_fake = bus_flush;
+	sid_pal_serial_bus_buf_in_ram_fake.return_val = true;
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.config = &config;
+	ctx.bus_iface = &bus_iface;
+	semtech_cmd_cache_init(&ctx.cmd_cache);
+	/* Drops the commands recorded by the previous test */
+	zassert_equal(lr11xx_hal_reset(&ctx), LR11XX_HAL_STATUS_OK);
+
+	memset(bus_log, 0, sizeof(bus_log));
+	bus_log_count = 0;
+}
+
+ZTEST_SUITE(semtech_lr11xx_hal, NULL, NULL, setup, NULL, NULL);
+
+static void write_cmd(uint16_t opcode, const uint8_t *params, size_t length)
+{
+	uint8_t command[2 + PARAMS_MAX] = { opcode >> 8, opcode & 0xFF };
+
+	memcpy(&command[2], params, length);
+	zassert_equal(lr11xx_hal_write(&ctx, command, 2 + length, NULL, 0), LR11XX_HAL_STATUS_OK);
+}
+
+static void read_status(void)
+{
+	const uint8_t command[] = { GET_STATUS >> 8, GET_STATUS & 0xFF };
+	uint8_t response[6];
+
+	zassert_equal(lr11xx_hal_read(&ctx, command, sizeof(command), response, sizeof(response)),
+		      LR11XX_HAL_STATUS_OK);
+}
+
+static void assert_sent(size_t index, uint16_t opcode, const uint8_t *params, size_t length)
+{
+	zassert_true(index < bus_log_count);
+	zassert_equal(bus_log[index].opcode, opcode, "command %zu is 0x%04X", index,
+		      bus_log[index].opcode);
+	zassert_equal(bus_log[index].length, length);
+	if (length) {
+		zassert_mem_equal(bus_log[index].params, params, length);
+	}
+}
+
+ZTEST(semtech_lr11xx_hal, test_override_keeps_place)
+{
+	const uint8_t freq_a[] = { 0x36, 0x41, 0x99, 0x9A };
+	const uint8_t freq_b[] = { 0x36, 0x42, 0x00, 0x00 };
+	const uint8_t tx_params[] = { 0x0E, 0x04 };
+
+	write_cmd(SET_RF_FREQUENCY, freq_a, sizeof(freq_a));
+	write_cmd(SET_TX_PARAMS, tx_params, sizeof(tx_params));
+	write_cmd(SET_RF_FREQUENCY, freq_b, sizeof(freq_b));
+	zassert_equal(bus_log_count, 0);
+
+	read_status();
+	zassert_equal(bus_log_count, 3);
+	assert_sent(0, SET_RF_FREQUENCY, freq_b, sizeof(freq_b));
+	assert_sent(1, SET_TX_PARAMS, tx_params, sizeof(tx_params));
+	assert_sent(2, GET_STATUS, NULL, 0);
+}
+
+ZTEST(semtech_lr11xx_hal, test_packet_type_barrier)
+{
+	const uint8_t gfsk[] = { 0x01 };
+	const uint8_t lora[] = { 0x02 };
+	const uint8_t mod_gfsk[] = { 0x00, 0x00, 0xC3, 0x50, 0x09, 0x1A, 0x00, 0x00, 0x61, 0xA8 };
+	const uint8_t mod_lora[] = { 0x07, 0x04, 0x01, 0x00 };
+
+	write_cmd(SET_PACKET_TYPE, gfsk, sizeof(gfsk));
+	write_cmd(SET_MODULATION_PARAMS, mod_gfsk, sizeof(mod_gfsk));
+	write_cmd(SET_PACKET_TYPE, lora, sizeof(lora));
+	/* Parameters of different packet types are not merged */
+	write_cmd(SET_MODULATION_PARAMS, mod_lora, sizeof(mod_lora));
+
+	read_status();
+	zassert_equal(bus_log_count, 5);
+	assert_sent(0, SET_PACKET_TYPE, gfsk, sizeof(gfsk));
+	assert_sent(1, SET_MODULATION_PARAMS, mod_gfsk, sizeof(mod_gfsk));
+	assert_sent(2, SET_PACKET_TYPE, lora, sizeof(lora));
+	assert_sent(3, SET_MODULATION_PARAMS, mod_lora, sizeof(mod_lora));
+	assert_sent(4, GET_STATUS, NULL, 0);
+}
+
+ZTEST(semtech_lr11xx_hal, test_packet_type_invalidates_cache)
+{
+	const uint8_t gfsk[] = { 0x01 };
+	const uint8_t lora[] = { 0x02 };
+	const uint8_t pa_config[] = { 0x00, 0x00, 0x04, 0x07 };
+
+	write_cmd(SET_PACKET_TYPE, lora, sizeof(lora));
+	write_cmd(SET_PA_CONFIG, pa_config, sizeof(pa_config));
+	read_status();
+	zassert_equal(bus_log_count, 3);
+
+	/* The radio has this configuration already */
+	write_cmd(SET_PA_CONFIG, pa_config, sizeof(pa_config));
+	read_status();
+	zassert_equal(bus_log_count, 4);
+	assert_sent(3, GET_STATUS, NULL, 0);
+
+	write_cmd(SET_PACKET_TYPE, gfsk, sizeof(gfsk));
+	write_cmd(SET_PA_CONFIG, pa_config, sizeof(pa_config));
+	read_status();
+	zassert_equal(bus_log_count, 7);
+	assert_sent(4, SET_PACKET_TYPE, gfsk, sizeof(gfsk));
+	assert_sent(5, SET_PA_CONFIG, pa_config, sizeof(pa_config));
+	assert_sent(6, GET_STATUS, NULL, 0);
+}
+
+ZTEST(semtech_lr11xx_hal, test_flush_before_read)
+{
+	const uint8_t freq[] = { 0x36, 0x41, 0x99, 0x9A };
+
+	write_cmd(SET_RF_FREQUENCY, freq, sizeof(freq));
+	read_status();
+
+	zassert_equal(bus_log_count, 2);
+	assert_sent(0, SET_RF_FREQUENCY, freq, sizeof(freq));
+	assert_sent(1, GET_STATUS, NULL, 0);
+}
+
+ZTEST(semtech_lr11xx_hal, test_flush_before_direct_read)
+{
+	const uint8_t freq[] = { 0x36, 0x41, 0x99, 0x9A };
+	uint8_t response[4];
+
+	write_cmd(SET_RF_FREQUENCY, freq, sizeof(freq));
+	zassert_equal(lr11xx_hal_direct_read(&ctx, response, sizeof(response), __func__),
+		      LR11XX_HAL_STATUS_OK);
+
+	zassert_equal(bus_log_count, 2);
+	assert_sent(0, SET_RF_FREQUENCY, freq, sizeof(freq));
+	assert_sent(1, DIRECT_READ, NULL, 0);
+}
+
+ZTEST(semtech_lr11xx_hal, test_flush_on_overflow)
+{
+	const uint8_t freq_a[] = { 0x36, 0x41, 0x99, 0x9A };
+	const uint8_t freq_b[] = { 0x36, 0x42, 0x00, 0x00 };
+	const uint8_t lora[] = { 0x02 };
+	const uint8_t mod[] = { 0x07, 0x04, 0x01, 0x00 };
+	const uint8_t pkt[] = { 0x00, 0x08, 0x00, 0xFF, 0x01, 0x00 };
+	const uint8_t tx_params[] = { 0x0E, 0x04 };
+
+	write_cmd(SET_PACKET_TYPE, lora, sizeof(lora));
+	write_cmd(SET_RF_FREQUENCY, freq_a, sizeof(freq_a));
+	write_cmd(SET_MODULATION_PARAMS, mod, sizeof(mod));
+	write_cmd(SET_PACKET_PARAMS, pkt, sizeof(pkt));
+	/* An override takes no room */
+	write_cmd(SET_RF_FREQUENCY, freq_b, sizeof(freq_b));
+	zassert_equal(bus_log_count, 0);
+
+	write_cmd(SET_TX_PARAMS, tx_params, sizeof(tx_params));
+	zassert_equal(bus_log_count, 4);
+	assert_sent(0, SET_PACKET_TYPE, lora, sizeof(lora));
+	assert_sent(1, SET_RF_FREQUENCY, freq_b, sizeof(freq_b));
+	assert_sent(2, SET_MODULATION_PARAMS, mod, sizeof(mod));
+	assert_sent(3, SET_PACKET_PARAMS, pkt, sizeof(pkt));
+
+	read_status();
+	zassert_equal(bus_log_count, 6);
+	assert_sent(4, SET_TX_PARAMS, tx_params, sizeof(tx_params));
+	assert_sent(5, GET_STATUS, NULL, 0);
+}
+
+ZTEST(semtech_lr11xx_hal, test_direct_read_ends_async_write)
+{
+	const uint8_t command[] = { WRITE_BUFFER8 >> 8, WRITE_BUFFER8 & 0xFF };
+	uint8_t payload[CONFIG_SIDEWALK_SPI_BUS_ASYNC_MIN_LEN] = { 0 };
+	uint8_t response[4];
+
+	zassert_equal(lr11xx_hal_write(&ctx, command, sizeof(command), payload, sizeof(payload)),
+		      LR11XX_HAL_STATUS_OK);
+	zassert_equal(bus_log_count, 1);
+
+	/* The radio goes to sleep, the direct read wakes it up with NSS */
+	ctx.sleeping = true;
+	ctx.radio_state = SID_PAL_RADIO_SLEEP;
+	sid_pal_gpio_write_fake.custom_fake = nss_write;
+	zassert_equal(lr11xx_hal_direct_read(&ctx, response, sizeof(response), __func__),
+		      LR11XX_HAL_STATUS_OK);
+
+	zassert_equal(bus_log_count, 5);
+	assert_sent(0, WRITE_BUFFER8, payload, sizeof(payload));
+	assert_sent(1, ASYNC_FLUSH, NULL, 0);
+	assert_sent(2, NSS_WRITE, NULL, 0);
+	assert_sent(3, NSS_WRITE, NULL, 0);
+	assert_sent(4, DIRECT_READ, NULL, 0);
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sx126x_radio.h>
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_set_direction, uint32_t, sid_pal_gpio_direction_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_input_mode, uint32_t, sid_pal_gpio_input_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_pull_mode, uint32_t, sid_pal_gpio_pull_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_write, uint32_t, uint8_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_irq_enable, uint32_t);
+FAKE_VALUE_FUNC(sid_error_t, sid_pal_gpio_irq_disable, uint32_t);
+FAKE_VOID_FUNC(sid_pal_delay_us, uint32_t);
+FAKE_VALUE_FUNC(sx126x_status_t, sx126x_wakeup, const void *);
+FAKE_VALUE_FUNC(int32_t, radio_sx126x_set_radio_mode, bool, bool);
+FAKE_VALUE_FUNC(int32_t, sx126x_wait_on_busy);
+FAKE_VALUE_FUNC(int32_t, sx126x_radio_bus_xfer, const uint8_t *, uint16_t, uint8_t *, uint16_t,
+		uint8_t);
+
+#define FFF_FAKES_LIST(FAKE)                                                                       \
+	FAKE(sid_pal_gpio_set_direction)                                                           \
+	FAKE(sid_pal_gpio_input_mode)                                                              \
+	FAKE(sid_pal_gpio_pull_mode)                                                               \
+	FAKE(sid_pal_gpio_write)                                                                   \
+	FAKE(sid_pal_gpio_irq_enable)                                                              \
+	FAKE(sid_pal_gpio_irq_disable)                                                             \
+	FAKE(sid_pal_delay_us)                                                                     \
+	FAKE(sx126x_wakeup)                                                                        \
+	FAKE(radio_sx126x_set_radio_mode)                                                          \
+	FAKE(sx126x_wait_on_busy)                                                                  \
+	FAKE(sx126x_radio_bus_xfer)
+
+/* Opcodes of the commands sent on the bus */
+static uint8_t bus_log[16];
+static size_t bus_log_count;
+
+static int32_t bus_xfer(const uint8_t *cmd_buffer, uint16_t cmd_buffer_size, uint8_t *buffer,
+			uint16_t size, uint8_t read_offset)
+{
+	ARG_UNUSED(cmd_buffer_size);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(size);
+	ARG_UNUSED(read_offset);
+
+	zassert_true(bus_log_count < ARRAY_SIZE(bus_log));
+	bus_log[bus_log_count++] = cmd_buffer[0];
+
+	return RADIO_ERROR_NONE;
+}
+
+static radio_sx126x_device_config_t config;
+static halo_drv_semtech_ctx_t ctx;
+
+static void setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	FFF_FAKES_LIST(RESET_FAKE);
+	FFF_RESET_HISTORY();
+	sx126x_radio_bus_xfer_fake.custom_fake = bus_xfer;
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.config = &config;
+	ctx.radio_state = SID_PAL_RADIO_STANDBY;
+	semtech_cmd_cache_init(&ctx.cmd_cache);
+
+	memset(bus_log, 0, sizeof(bus_log));
+	bus_log_count = 0;
+}
+
+ZTEST_SUITE(semtech_sx126x_hal, NULL, NULL, setup, NULL, NULL);
+
+static void write_cmd(const uint8_t *command, uint16_t command_length, const uint8_t *data,
+		      uint16_t data_length)
+{
+	zassert_equal(sx126x_hal_write(&ctx, command, command_length, data, data_length),
+		      SX126X_HAL_STATUS_OK);
+}
+
+static void write_register(uint16_t address, const uint8_t *data, uint16_t data_length)
+{
+	const uint8_t command[] = { SX126X_WRITE_REGISTER, address >> 8, address & 0xFF };
+
+	write_cmd(command, sizeof(command), data, data_length);
+}
+
+ZTEST(semtech_sx126x_hal, test_repeat_is_skipped)
+{
+	const uint8_t pa_config[] = { SX126X_SET_PACONFIG, 0x04, 0x07, 0x00, 0x01 };
+
+	write_cmd(pa_config, sizeof(pa_config), NULL, 0);
+	write_cmd(pa_config, sizeof(pa_config), NULL, 0);
+
+	zassert_equal(bus_log_count, 1);
+	zassert_equal(bus_log[0], SX126X_SET_PACONFIG);
+}
+
+ZTEST(semtech_sx126x_hal, test_packet_type_invalidates_cache)
+{
+	const uint8_t gfsk[] = { SX126X_SET_PACKETTYPE, SX126X_PKT_TYPE_GFSK };
+	const uint8_t lora[] = { SX126X_SET_PACKETTYPE, SX126X_PKT_TYPE_LORA };
+	const uint8_t pa_config[] = { SX126X_SET_PACONFIG, 0x04, 0x07, 0x00, 0x01 };
+
+	write_cmd(lora, sizeof(lora), NULL, 0);
+	write_cmd(pa_config, sizeof(pa_config), NULL, 0);
+	write_cmd(lora, sizeof(lora), NULL, 0);
+	write_cmd(pa_config, sizeof(pa_config), NULL, 0);
+	zassert_equal(bus_log_count, 2);
+
+	/* The parameters set for LoRa are sent again for GFSK */
+	write_cmd(gfsk, sizeof(gfsk), NULL, 0);
+	write_cmd(pa_config, sizeof(pa_config), NULL, 0);
+	zassert_equal(bus_log_count, 4);
+	zassert_equal(bus_log[2], SX126X_SET_PACKETTYPE);
+	zassert_equal(bus_log[3], SX126X_SET_PACONFIG);
+}
+
+ZTEST(semtech_sx126x_hal, test_register_write_match)
+{
+	const uint8_t sync_word_a[] = { 0x34, 0x44 };
+	const uint8_t sync_word_b[] = { 0x14, 0x24 };
+	const uint8_t ocp[] = { 0x38 };
+
+	write_register(SX126X_REG_LR_SYNCWORD, sync_word_a, sizeof(sync_word_a));
+	write_register(SX126X_REG_LR_SYNCWORD, sync_word_a, sizeof(sync_word_a));
+	zassert_equal(bus_log_count, 1);
+
+	/* The value is a part of the shadowed configuration */
+	write_register(SX126X_REG_LR_SYNCWORD, sync_word_b, sizeof(sync_word_b));
+	zassert_equal(bus_log_count, 2);
+
+	/* Other registers are always written */
+	write_register(SX126X_REG_OCP, ocp, sizeof(ocp));
+	write_register(SX126X_REG_OCP, ocp, sizeof(ocp));
+	zassert_equal(bus_log_count, 4);
+}
+
+ZTEST(semtech_sx126x_hal, test_skipped_command_wakes_radio)
+{
+	const uint8_t pa_config[] = { SX126X_SET_PACONFIG, 0x04, 0x07, 0x00, 0x01 };
+	const uint8_t states[] = { SID_PAL_RADIO_RX_DC, SID_PAL_RADIO_SLEEP };
+
+	write_cmd(pa_config, sizeof(pa_config), NULL, 0);
+	zassert_equal(sx126x_wakeup_fake.call_count, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(states); i++) {
+		ctx.radio_state = states[i];
+		write_cmd(pa_config, sizeof(pa_config), NULL, 0);
+		zassert_equal(sx126x_wakeup_fake.call_count, i + 1);
+		zassert_equal(radio_sx126x_set_radio_mode_fake.call_count, i + 1);
+	}
+
+	/* The radio is in the configuration already */
+	zassert_equal(bus_log_count, 1);
+}
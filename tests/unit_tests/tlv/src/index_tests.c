@@ -0,0 +1,207 @@
+/**
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <tlv/tlv.h>
+#include <tlv/tlv_storage_impl.h>
+
+#define MARKER_SIZE 8
+#define MFG_FLAGS_TYPE 0x6FFF
+
+static uint8_t storage[2048];
+static uint32_t read_count;
+static struct tlv_index tlv_idx;
+
+static int counting_read(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_size)
+{
+	read_count++;
+	return tlv_storage_ram_read(ctx, offset, data, data_size);
+}
+
+static tlv_ctx new_ctx(void)
+{
+	return (tlv_ctx){ .start_offset = 0,
+			  .end_offset = sizeof(storage),
+			  .tlv_storage_start_marker_size = MARKER_SIZE,
+			  .storage_impl = { .ctx = storage,
+					    .read = counting_read,
+					    .erase = tlv_storage_ram_erase,
+					    .write = tlv_storage_ram_write } };
+}
+
+static void setUp(void *f)
+{
+	memset(storage, 0xff, sizeof(storage));
+	read_count = 0;
+}
+
+ZTEST_SUITE(tlv_index, NULL, NULL, setUp, NULL, NULL);
+
+/* Values of a manufacturing storage: SMSN, keys, signatures, serials, APID and DTID */
+static uint8_t mfg_value_size(tlv_type type)
+{
+	static const uint8_t sizes[] = { 0, 0, 0, 17, 32, 32, 32, 32, 64, 32, 64, 64, 32, 64, 4,
+					 64, 64, 4, 32, 64, 4, 64, 64, 4, 32, 64, 4, 64, 64, 4,
+					 32, 64, 4, 64, 64, 4, 32, 64, 4, 14 };
+	return sizes[type];
+}
+
+static void write_mfg_values(tlv_ctx *ctx)
+{
+	uint8_t value[64];
+
+	for (tlv_type type = 3; type <= 39; type++) {
+		memset(value, type, sizeof(value));
+		zassert_equal(tlv_write(ctx, type, value, mfg_value_size(type)), 0);
+	}
+	const uint8_t flags[4] = { 1 };
+	zassert_equal(tlv_write(ctx, MFG_FLAGS_TYPE, flags, sizeof(flags)), 0);
+}
+
+ZTEST(tlv_index, test_index_matches_scan)
+{
+	tlv_ctx scan = new_ctx();
+	tlv_ctx indexed = new_ctx();
+
+	write_mfg_values(&scan);
+	zassert_equal(tlv_index_build(&indexed, &tlv_idx), 0);
+	zassert_true(tlv_idx.complete);
+	zassert_equal(tlv_idx.count, 38);
+
+	for (tlv_type type = 0; type <= 40; type++) {
+		tlv_header expected = {};
+		tlv_header header = {};
+		uint8_t expected_data[64] = { 0 };
+		uint8_t data[64] = { 0 };
+
+		zassert_equal(tlv_lookup(&indexed, type, &header),
+			      tlv_lookup(&scan, type, &expected));
+		zassert_mem_equal(&header, &expected, sizeof(header));
+
+		const uint16_t size = MIN(header.payload_size.data_size + 1, sizeof(data));
+		zassert_equal(tlv_read(&indexed, type, data, size),
+			      tlv_read(&scan, type, expected_data, size));
+		zassert_mem_equal(data, expected_data, size);
+	}
+}
+
+ZTEST(tlv_index, test_index_missing_type_reads_nothing)
+{
+	tlv_ctx ctx = new_ctx();
+
+	write_mfg_values(&ctx);
+	zassert_equal(tlv_index_build(&ctx, &tlv_idx), 0);
+
+	read_count = 0;
+	zassert_equal(tlv_lookup(&ctx, 1000, NULL), -ENODATA);
+	zassert_equal(tlv_read(&ctx, 1000, (uint8_t[4]){}, 4), -ENODATA);
+	zassert_equal(read_count, 0);
+}
+
+ZTEST(tlv_index, test_index_write_updates_index)
+{
+	tlv_ctx scan = new_ctx();
+	tlv_ctx ctx = new_ctx();
+	const uint8_t value[5] = { 1, 2, 3, 4, 5 };
+	uint8_t data[5] = { 0 };
+
+	zassert_equal(tlv_index_build(&ctx, &tlv_idx), 0);
+	zassert_equal(tlv_idx.next_free_offset, MARKER_SIZE);
+	zassert_equal(tlv_write(&ctx, 7, value, sizeof(value)), 0);
+	zassert_equal(tlv_write(&ctx, 8, value, 2), 0);
+
+	read_count = 0;
+	zassert_equal(tlv_write(&ctx, 9, value, 3), 0);
+	zassert_equal(read_count, 0, "next free offset not cached");
+	zassert_equal(tlv_idx.next_free_offset, MARKER_SIZE + 3 * sizeof(tlv_header) + 8 + 4 + 4);
+
+	/* the index and the storage agree */
+	zassert_equal(tlv_read(&ctx, 7, data, sizeof(data)), 0);
+	zassert_mem_equal(data, value, sizeof(value));
+	zassert_equal(read_count, 1);
+	zassert_equal(tlv_read(&scan, 9, data, 3), 0);
+	zassert_mem_equal(data, value, 3);
+}
+
+ZTEST(tlv_index, test_index_first_entry_wins)
+{
+	tlv_ctx ctx = new_ctx();
+	uint8_t data[4] = { 0 };
+
+	zassert_equal(tlv_write(&ctx, 5, (uint8_t[4]){ 1, 1, 1, 1 }, 4), 0);
+	zassert_equal(tlv_write(&ctx, 5, (uint8_t[4]){ 2, 2, 2, 2 }, 4), 0);
+	zassert_equal(tlv_index_build(&ctx, &tlv_idx), 0);
+	zassert_equal(tlv_write(&ctx, 5, (uint8_t[4]){ 3, 3, 3, 3 }, 4), 0);
+
+	zassert_equal(tlv_read(&ctx, 5, data, sizeof(data)), 0);
+	zassert_mem_equal(data, ((uint8_t[4]){ 1, 1, 1, 1 }), sizeof(data));
+}
+
+ZTEST(tlv_index, test_index_full_falls_back_to_scan)
+{
+	tlv_ctx ctx = new_ctx();
+	const tlv_type types = CONFIG_SIDEWALK_TLV_INDEX_SIZE + 2;
+
+	for (tlv_type type = 1; type <= types; type++) {
+		zassert_equal(tlv_write(&ctx, type, (uint8_t *)&type, sizeof(type)), 0);
+	}
+	zassert_equal(tlv_index_build(&ctx, &tlv_idx), 0);
+	zassert_false(tlv_idx.complete);
+
+	for (tlv_type type = 1; type <= types; type++) {
+		tlv_type data = 0;
+
+		zassert_equal(tlv_read(&ctx, type, (uint8_t *)&data, sizeof(data)), 0);
+		zassert_equal(data, type);
+	}
+	zassert_equal(tlv_lookup(&ctx, types + 1, NULL), -ENODATA);
+}
+
+ZTEST(tlv_index, test_index_invalidate)
+{
+	tlv_ctx ctx = new_ctx();
+
+	write_mfg_values(&ctx);
+	zassert_equal(tlv_index_build(&ctx, &tlv_idx), 0);
+	tlv_index_invalidate(&ctx);
+	zassert_is_null(ctx.index);
+
+	memset(storage, 0xff, sizeof(storage));
+	zassert_equal(tlv_lookup(&ctx, 4, NULL), -ENODATA);
+}
+
+/* Reads done by the mfg storage at boot: flags, then every value once */
+static uint32_t boot_reads(tlv_ctx *ctx)
+{
+	uint8_t data[64];
+
+	read_count = 0;
+	zassert_equal(tlv_read(ctx, MFG_FLAGS_TYPE, data, 4), 0);
+	for (tlv_type type = 3; type <= 39; type++) {
+		zassert_equal(tlv_read(ctx, type, data, mfg_value_size(type)), 0);
+	}
+	return read_count;
+}
+
+ZTEST(tlv_index, test_index_benchmark_boot_reads)
+{
+	tlv_ctx scan = new_ctx();
+	tlv_ctx indexed = new_ctx();
+
+	write_mfg_values(&scan);
+	const uint32_t scan_reads = boot_reads(&scan);
+
+	read_count = 0;
+	zassert_equal(tlv_index_build(&indexed, &tlv_idx), 0);
+	const uint32_t build_reads = read_count;
+	const uint32_t indexed_reads = build_reads + boot_reads(&indexed);
+
+	TC_PRINT("storage reads per boot: scan %u, index %u (build %u)\n", scan_reads,
+		 indexed_reads, build_reads);
+	zassert_true(indexed_reads < scan_reads);
+}
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <tlv/tlv.h>
+#include <tlv/tlv_storage_impl.h>
+
+#define MARKER_SIZE 8
+#define STORAGE_SIZE 1024
+
+/* bytes after the end of the TLV region, that must not be read */
+static uint8_t storage[STORAGE_SIZE + 16];
+static uint32_t driver_reads;
+static uint32_t read_beyond_end;
+static struct tlv_read_ahead read_ahead;
+
+static int counting_read(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_size)
+{
+	driver_reads++;
+	if (offset + data_size > STORAGE_SIZE) {
+		read_beyond_end++;
+	}
+	return tlv_storage_ram_read(ctx, offset, data, data_size);
+}
+
+static int failing_read(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_size)
+{
+	return -EIO;
+}
+
+static tlv_ctx new_ctx(void)
+{
+	return (tlv_ctx){ .start_offset = 0,
+			  .end_offset = STORAGE_SIZE,
+			  .tlv_storage_start_marker_size = MARKER_SIZE,
+			  .storage_impl = { .ctx = storage,
+					    .read = counting_read,
+					    .erase = tlv_storage_ram_erase,
+					    .write = tlv_storage_ram_write } };
+}
+
+static void setUp(void *f)
+{
+	memset(storage, 0xff, sizeof(storage));
+	driver_reads = 0;
+	read_beyond_end = 0;
+}
+
+ZTEST_SUITE(tlv_read_ahead, NULL, NULL, setUp, NULL, NULL);
+
+static void write_entries(tlv_ctx *ctx, tlv_type count)
+{
+	uint8_t value[13];
+
+	for (tlv_type type = 1; type <= count; type++) {
+		memset(value, type, sizeof(value));
+		zassert_equal(tlv_write(ctx, type, value, type % sizeof(value) + 1), 0);
+	}
+}
+
+ZTEST(tlv_read_ahead, test_read_ahead_matches_storage)
+{
+	tlv_ctx direct = new_ctx();
+	tlv_ctx ctx = new_ctx();
+
+	write_entries(&direct, 40);
+	zassert_equal(tlv_read_ahead_attach(&ctx, &read_ahead), 0);
+
+	for (tlv_type type = 1; type <= 41; type++) {
+		tlv_header expected = {};
+		tlv_header header = {};
+		uint8_t expected_data[16] = { 0 };
+		uint8_t data[16] = { 0 };
+
+		zassert_equal(tlv_lookup(&ctx, type, &header),
+			      tlv_lookup(&direct, type, &expected));
+		zassert_mem_equal(&header, &expected, sizeof(header));
+		zassert_equal(tlv_read(&ctx, type, data, header.payload_size.data_size),
+			      tlv_read(&direct, type, expected_data, header.payload_size.data_size));
+		zassert_mem_equal(data, expected_data, sizeof(data));
+	}
+	zassert_equal(read_beyond_end, 0);
+}
+
+ZTEST(tlv_read_ahead, test_read_ahead_saves_driver_calls)
+{
+	tlv_ctx direct = new_ctx();
+	tlv_ctx ctx = new_ctx();
+	uint8_t data[13];
+
+	write_entries(&direct, 40);
+	driver_reads = 0;
+	zassert_equal(tlv_read(&direct, 40, data, 1), 0);
+	const uint32_t direct_reads = driver_reads;
+
+	zassert_equal(tlv_read_ahead_attach(&ctx, &read_ahead), 0);
+	driver_reads = 0;
+	zassert_equal(tlv_read(&ctx, 40, data, 1), 0);
+
+	TC_PRINT("driver reads for the last entry: direct %u, read-ahead %u\n", direct_reads,
+		 driver_reads);
+	zassert_equal(driver_reads, read_ahead.stats.backend_reads);
+	zassert_equal(read_ahead.stats.reads, direct_reads);
+	zassert_equal(read_ahead.stats.hits, read_ahead.stats.reads - driver_reads);
+	zassert_true(driver_reads * 4 < direct_reads);
+}
+
+ZTEST(tlv_read_ahead, test_read_ahead_write_invalidates)
+{
+	tlv_ctx ctx = new_ctx();
+	uint8_t data[4] = { 0 };
+
+	zassert_equal(tlv_read_ahead_attach(&ctx, &read_ahead), 0);
+	zassert_equal(tlv_lookup(&ctx, 3, NULL), -ENODATA);
+	zassert_equal(tlv_write(&ctx, 3, (uint8_t[4]){ 1, 2, 3, 4 }, 4), 0);
+	zassert_equal(tlv_read(&ctx, 3, data, sizeof(data)), 0);
+	zassert_mem_equal(data, ((uint8_t[4]){ 1, 2, 3, 4 }), sizeof(data));
+
+	zassert_equal(ctx.storage_impl.erase(ctx.storage_impl.ctx, 0, STORAGE_SIZE), 0);
+	zassert_equal(tlv_read(&ctx, 3, data, sizeof(data)), -ENODATA);
+}
+
+ZTEST(tlv_read_ahead, test_read_ahead_invalidate_zeroes_window)
+{
+	tlv_ctx ctx = new_ctx();
+	uint8_t data[4] = { 0 };
+	const uint8_t zeros[sizeof(read_ahead.window)] = { 0 };
+
+	zassert_equal(tlv_write(&ctx, 3, (uint8_t[4]){ 1, 2, 3, 4 }, 4), 0);
+	zassert_equal(tlv_read_ahead_attach(&ctx, &read_ahead), 0);
+	zassert_equal(tlv_read(&ctx, 3, data, sizeof(data)), 0);
+	zassert_not_equal(read_ahead.window_size, 0);
+
+	tlv_read_ahead_invalidate(&read_ahead);
+	zassert_equal(read_ahead.window_size, 0);
+	zassert_mem_equal(read_ahead.window, zeros, sizeof(zeros));
+
+	/* the next read fills the window again */
+	zassert_equal(tlv_read(&ctx, 3, data, sizeof(data)), 0);
+	zassert_mem_equal(data, ((uint8_t[4]){ 1, 2, 3, 4 }), sizeof(data));
+}
+
+ZTEST(tlv_read_ahead, test_read_ahead_large_read_bypasses_window)
+{
+	tlv_ctx ctx = new_ctx();
+	uint8_t data[CONFIG_SIDEWALK_TLV_READ_AHEAD_SIZE] = { 0 };
+
+	zassert_equal(tlv_read_ahead_attach(&ctx, &read_ahead), 0);
+	zassert_equal(ctx.storage_impl.read(ctx.storage_impl.ctx, 0, data, sizeof(data)), 0);
+	zassert_equal(driver_reads, 1);
+	zassert_equal(read_ahead.window_size, 0);
+
+	/* the window is cut at the end of the region */
+	zassert_equal(ctx.storage_impl.read(ctx.storage_impl.ctx, STORAGE_SIZE - 8, data, 4), 0);
+	zassert_equal(read_ahead.window_size, 8);
+	zassert_equal(read_beyond_end, 0);
+}
+
+ZTEST(tlv_read_ahead, test_read_ahead_read_error)
+{
+	tlv_ctx ctx = new_ctx();
+
+	ctx.storage_impl.read = failing_read;
+	zassert_equal(tlv_read_ahead_attach(&ctx, &read_ahead), 0);
+	zassert_equal(tlv_lookup(&ctx, 1, NULL), -EIO);
+	zassert_equal(read_ahead.window_size, 0);
+}
+
+ZTEST(tlv_read_ahead, test_read_ahead_invalid_ctx)
+{
+	tlv_ctx ctx = new_ctx();
+
+	ctx.storage_impl.read = NULL;
+	zassert_equal(tlv_read_ahead_attach(&ctx, &read_ahead), -EINVAL);
+	zassert_equal(tlv_read_ahead_attach(NULL, &read_ahead), -EINVAL);
+}
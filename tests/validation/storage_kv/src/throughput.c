@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define FACTORY_RESET_GROUP 0
+#define THROUGHPUT_GROUP 2
+#define RECORDS 32
+#define RECORD_SIZE 16
+
+static uint32_t records_per_s(int64_t start_ms, uint32_t records)
+{
+	int64_t elapsed_ms = MAX(k_uptime_get() - start_ms, 1);
+
+	return records * MSEC_PER_SEC / elapsed_ms;
+}
+
+ZTEST(storage_throughput, test_record_throughput)
+{
+	uint8_t value[RECORD_SIZE];
+	uint8_t read[RECORD_SIZE];
+	int64_t start;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+
+	start = k_uptime_get();
+	for (uint16_t key = 0; key < RECORDS; key++) {
+		memset(value, key, sizeof(value));
+		zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(
+						      THROUGHPUT_GROUP, key, value, sizeof(value)));
+	}
+	const uint32_t set_rate = records_per_s(start, RECORDS);
+
+	start = k_uptime_get();
+	for (uint16_t key = 0; key < RECORDS; key++) {
+		memset(value, key, sizeof(value));
+		zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(
+						      THROUGHPUT_GROUP, key, read, sizeof(read)));
+		zassert_mem_equal(value, read, sizeof(read));
+	}
+	const uint32_t get_rate = records_per_s(start, RECORDS);
+
+	start = k_uptime_get();
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(THROUGHPUT_GROUP));
+	const uint32_t delete_rate = records_per_s(start, RECORDS);
+
+	TC_PRINT("%s backend: set %u records/s, get %u records/s, group delete %u records/s\n",
+		 IS_ENABLED(CONFIG_SIDEWALK_STORAGE_KV_BACKEND_ZMS) ? "ZMS" : "settings", set_rate,
+		 get_rate, delete_rate);
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(THROUGHPUT_GROUP, 0, read, sizeof(read)));
+}
+
+ZTEST(storage_throughput, test_factory_reset_time)
+{
+	uint8_t value[RECORD_SIZE] = { 0 };
+	uint8_t read[RECORD_SIZE];
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	for (uint16_t key = 0; key < RECORDS; key++) {
+		/* keys of the master keys are kept by the crypto storage, skip them */
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(FACTORY_RESET_GROUP, 0x100 + key, value,
+							    sizeof(value)));
+	}
+
+	int64_t start = k_uptime_ticks();
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(FACTORY_RESET_GROUP));
+	const uint32_t delete_us = k_ticks_to_us_floor32(k_uptime_ticks() - start);
+
+	TC_PRINT("factory reset of %u records: %u us\n", RECORDS, delete_us);
+	for (uint16_t key = 0; key < RECORDS; key++) {
+		zassert_equal(SID_ERROR_NOT_FOUND,
+			      sid_pal_storage_kv_record_get(FACTORY_RESET_GROUP, 0x100 + key, read,
+							    sizeof(read)));
+	}
+}
+
+ZTEST_SUITE(storage_throughput, NULL, NULL, NULL, NULL, NULL);
@@ -8,6 +8,7 @@
 #define NORDIC_DFU_IMG_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief Init dfu image management based on dfu mutli image and mcuboot
@@ -26,6 +27,65 @@ int nordic_dfu_img_init(void);
  */
 int nordic_dfu_img_write(size_t offset, void *data, size_t data_size);
 
+/**
+ * @brief Callback of a write that waited for a free buffer
+ * 
+ * @param ctx context given to nordic_dfu_img_write_async
+ * @param err 0 if the data was consumed, negative error code if it was dropped
+ */
+typedef void (*nordic_dfu_img_done_t)(void *ctx, int err);
+
+/**
+ * @brief Write a chunk of data to the new image partition on the dfu work queue
+ * 
+ * The data is copied to the buffer being filled, and a full buffer is written to flash
+ * on the work queue. If both buffers are busy, the data is kept and the done callback
+ * is called from the work queue once it was copied, the data must stay valid until then.
+ * Chunks must be written in order, data written before is skipped.
+ * Do not mix with nordic_dfu_img_write.
+ * 
+ * @param offset chunk data offset
+ * @param data pointer to data buffer
+ * @param data_size size of the buffer data
+ * @param done callback called if the data could not be consumed at once
+ * @param ctx context for the callback
+ * @return 0 if the data was consumed, -EINPROGRESS if the done callback will be called,
+ * -ENOBUFS if too many writes wait, -ECANCELED after nordic_dfu_img_cancel until
+ * the next nordic_dfu_img_init, other negative error code if the image write failed
+ */
+int nordic_dfu_img_write_async(size_t offset, void *data, size_t data_size,
+			       nordic_dfu_img_done_t done, void *ctx);
+
+struct nordic_dfu_img_stats {
+	/* bytes written to flash */
+	uint32_t bytes;
+	/* buffers written to flash */
+	uint32_t flushes;
+	/* writes that waited for a free buffer */
+	uint32_t deferred;
+	/* time spent writing to flash */
+	uint32_t flash_time_us;
+	uint32_t flash_time_max_us;
+	/* time from the first write to the end of the last flash write */
+	uint32_t elapsed_ms;
+	/* image throughput over the elapsed time */
+	uint32_t bytes_per_s;
+	/* throughput of the flash writes alone */
+	uint32_t flash_bytes_per_s;
+};
+
+/**
+ * @brief Get statistics of the asynchronous image writes since the last init or reset
+ * 
+ * @param stats pointer to the statistics to fill
+ */
+void nordic_dfu_img_stats_get(struct nordic_dfu_img_stats *stats);
+
+/**
+ * @brief Reset statistics of the asynchronous image writes
+ */
+void nordic_dfu_img_stats_reset(void);
+
 /**
  * @brief Cancel dfu image processing.
  * 
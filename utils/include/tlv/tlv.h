@@ -44,6 +44,38 @@ typedef int (*tlv_storage_erase_t)(void *ctx, uint32_t offset, uint32_t size);
  */
 typedef int (*tlv_storage_read_t)(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_cap);
 
+typedef uint16_t tlv_type;
+typedef struct {
+	uint8_t padding;
+	uint8_t data_size;
+} tlv_size;
+
+typedef struct {
+	tlv_type type;
+	tlv_size payload_size;
+} tlv_header;
+
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+/**
+ * @brief RAM copy of the TLV headers, so lookups do not read the storage.
+ *
+ * Only the first entry of a type is indexed, as it is the one found by a lookup. The index ends
+ * at the first free slot, entries after it are not visible.
+ */
+struct tlv_index {
+	struct tlv_index_entry {
+		tlv_type type;
+		tlv_size payload_size;
+		/* offset of the payload */
+		uint32_t offset;
+	} entries[CONFIG_SIDEWALK_TLV_INDEX_SIZE];
+	uint16_t count;
+	/* false when some types did not fit, they are looked up in the storage */
+	bool complete;
+	uint32_t next_free_offset;
+};
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+
 typedef struct tlv_ctx {
 	struct tlv_storage {
 		void *ctx;
@@ -57,18 +89,41 @@ typedef struct tlv_ctx {
 	uint32_t end_offset;
 	/* size of starting marker, after the marker the first tlv entry is stored.*/
 	uint32_t tlv_storage_start_marker_size;
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	/* index used by lookups, reads and writes, NULL to scan the storage */
+	struct tlv_index *index;
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
 } tlv_ctx;
 
-typedef uint16_t tlv_type;
-typedef struct {
-	uint8_t padding;
-	uint8_t data_size;
-} tlv_size;
+#ifdef CONFIG_SIDEWALK_TLV_READ_AHEAD
+struct tlv_read_ahead_stats {
+	/* reads requested by the TLV module */
+	uint32_t reads;
+	/* reads served from the window, each one is a storage driver call saved */
+	uint32_t hits;
+	/* calls to the storage driver read */
+	uint32_t backend_reads;
+};
 
-typedef struct {
-	tlv_type type;
-	tlv_size payload_size;
-} tlv_header;
+/**
+ * @brief Read-ahead window in front of a TLV storage.
+ *
+ * A read that misses the window fills it with one bigger read of the storage, so the following
+ * headers and payloads are copied from RAM. Writes and erases go to the storage and drop the
+ * window when they overlap it.
+ */
+struct tlv_read_ahead {
+	/* storage behind the window */
+	struct tlv_storage backend;
+	/* first offset that is not read, the window does not cross it */
+	uint32_t end_offset;
+	uint32_t window_offset;
+	/* number of valid bytes in the window, 0 when empty */
+	uint32_t window_size;
+	uint8_t window[CONFIG_SIDEWALK_TLV_READ_AHEAD_SIZE];
+	struct tlv_read_ahead_stats stats;
+};
+#endif /* CONFIG_SIDEWALK_TLV_READ_AHEAD */
 
 /**
  * @brief read the header of the TLV storage
@@ -134,4 +189,88 @@ int tlv_read(tlv_ctx *ctx, tlv_type type, uint8_t *data, uint16_t data_size);
  */
 int tlv_write(tlv_ctx *ctx, tlv_type type, const uint8_t *data, uint16_t data_size);
 
+/**
+ * @brief Append cursor, writes entries one after another without looking for the free space.
+ *
+ * Only the writer may add entries to the storage while it is used.
+ */
+struct tlv_writer {
+	tlv_ctx *ctx;
+	/* offset of the next entry */
+	uint32_t offset;
+};
+
+/**
+ * @brief Start appending entries after the last entry in the storage.
+ *
+ * @param writer [OUT] cursor to initialize
+ * @param ctx tlv context
+ * @return int 0 on success, negative in case of error
+ *   -EINVAL when ctx is invalid
+ */
+int tlv_writer_init(struct tlv_writer *writer, tlv_ctx *ctx);
+
+/**
+ * @brief Append data to TLV, same as tlv_write without the scan for the free space.
+ *
+ * @param writer cursor
+ * @param type type to write
+ * @param data payload to write
+ * @param data_size size of payload to write
+ * @return int 0 on success, negative in case of error
+ *   -EINVAL when writer is invalid
+ *   -ENOMEM when can not fit data in storage
+ *   other errors are passed from storage handlers.
+ */
+int tlv_writer_append(struct tlv_writer *writer, tlv_type type, const uint8_t *data,
+		      uint16_t data_size);
+
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+/**
+ * @brief Scan the storage once and use the index for the next operations on the context.
+ *
+ * tlv_write keeps the index up to date. Changes made to the storage in other ways need
+ * tlv_index_invalidate or a new build.
+ *
+ * @param ctx tlv context
+ * @param index [OUT] index to fill, must stay valid while the context uses it
+ * @return int 0 on success, negative in case of error
+ *   -EINVAL when ctx is invalid
+ *   other errors are passed from storage handlers, the context is left without an index then.
+ */
+int tlv_index_build(tlv_ctx *ctx, struct tlv_index *index);
+
+/**
+ * @brief Stop using the index, the next operations scan the storage.
+ *
+ * @param ctx tlv context
+ */
+void tlv_index_invalidate(tlv_ctx *ctx);
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+
+#ifdef CONFIG_SIDEWALK_TLV_READ_AHEAD
+/**
+ * @brief Put a read-ahead window in front of the storage of the context.
+ *
+ * The storage handlers of the context are moved to the window, and the context reads, writes
+ * and erases through it. Works with any storage backend.
+ *
+ * @param ctx tlv context with the storage handlers set
+ * @param read_ahead [OUT] window to use, must stay valid while the context uses it
+ * @return int 0 on success, negative in case of error
+ *   -EINVAL when ctx is invalid
+ */
+int tlv_read_ahead_attach(tlv_ctx *ctx, struct tlv_read_ahead *read_ahead);
+
+/**
+ * @brief Drop the content of the window, the next read goes to the storage.
+ *
+ * The window is zeroed, call it when the storage holds secrets that must not stay in RAM.
+ * Also needed when the storage is changed without the handlers of the context.
+ *
+ * @param read_ahead window
+ */
+void tlv_read_ahead_invalidate(struct tlv_read_ahead *read_ahead);
+#endif /* CONFIG_SIDEWALK_TLV_READ_AHEAD */
+
 #endif
@@ -10,10 +10,43 @@
 #include <zephyr/settings/settings.h>
 #include <errno.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(settings_utils, CONFIG_SIDEWALK_LOG_LEVEL);
 
+#ifdef CONFIG_SIDEWALK_SETTINGS_UTILS_DIRECT_LOAD
+/*
+ * Look up one name in the settings backends. The ZMS backend finds the value by the hash of
+ * the name, without walking all records of the subtree.
+ */
+int settings_utils_load_immediate_value(const char *name, void *dest, size_t len)
+{
+	ssize_t rc = settings_load_one(name, dest, len);
+	if (rc == 0 || rc == -ENOENT) {
+		LOG_DBG("Failed to fetch %s key", name);
+		return -ENOENT;
+	}
+	if (rc < 0) {
+		LOG_ERR("fail (err %d)", (int)rc);
+		return rc;
+	}
+
+	LOG_DBG("loaded %s key", name);
+	return MIN((size_t)rc, len);
+}
+
+int settings_utils_get_value_size(const char *name, size_t *len)
+{
+	ssize_t rc = settings_get_val_len(name);
+	if (rc < 0) {
+		return rc;
+	}
+
+	*len = rc;
+	return 0;
+}
+#else
 /**
  * Structure for immediate request from settings
  * 
@@ -94,6 +127,7 @@ int settings_utils_get_value_size(const char *name, size_t *len)
 
 	return rc;
 }
+#endif /* CONFIG_SIDEWALK_SETTINGS_UTILS_DIRECT_LOAD */
 
 #if defined(DEPRECATED_DFU_FLAG_SETTINGS_KEY)
 app_start_t application_to_start(void)
@@ -9,7 +9,9 @@
 #include <dfu/dfu_target.h>
 #include <dfu/dfu_target_mcuboot.h>
 
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <string.h>
 
 LOG_MODULE_REGISTER(nordic_dfu_img, CONFIG_SIDEWALK_LOG_LEVEL);
 
@@ -48,9 +50,337 @@ static int close(bool success)
 	return success ? dfu_target_done(success) : dfu_target_reset();
 }
 
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+#define CHUNK_SIZE CONFIG_SIDEWALK_DFU_IMG_ASYNC_CHUNK_SIZE
+#define PENDING_MAX CONFIG_SIDEWALK_DFU_IMG_ASYNC_PENDING
+
+struct chunk {
+	uint8_t data[CHUNK_SIZE] __aligned(4);
+	size_t offset;
+	size_t len;
+	/* full, waiting for or in the flash write */
+	bool ready;
+};
+
+struct pending {
+	size_t offset;
+	const uint8_t *data;
+	size_t size;
+	nordic_dfu_img_done_t done;
+	void *ctx;
+};
+
+struct done_call {
+	nordic_dfu_img_done_t done;
+	void *ctx;
+	int err;
+};
+
+/* Two chunks are filled and written in turn, fill_idx is never ready unless both are */
+static struct chunk chunks[2];
+static uint8_t fill_idx;
+static uint8_t flush_idx;
+static size_t next_offset;
+
+static struct pending pending[PENDING_MAX];
+static uint8_t pending_head;
+static uint8_t pending_count;
+
+static bool async_initialized;
+static int async_err;
+static bool async_final;
+
+static struct nordic_dfu_img_stats stats;
+static int64_t first_write_ms;
+
+static K_MUTEX_DEFINE(async_lock);
+K_THREAD_STACK_DEFINE(nordic_dfu_img_workq_stack, CONFIG_SIDEWALK_DFU_IMG_ASYNC_STACK_SIZE);
+static struct k_work_q nordic_dfu_img_workq;
+static struct k_work flush_work;
+
+static void chunk_submit(void)
+{
+	chunks[fill_idx].ready = true;
+	if (!chunks[fill_idx ^ 1].ready) {
+		fill_idx ^= 1;
+	}
+	(void)k_work_submit_to_queue(&nordic_dfu_img_workq, &flush_work);
+}
+
+/* Copy as much data as fits in the free chunks, returns the number of bytes consumed */
+static size_t chunk_feed(size_t offset, const uint8_t *data, size_t size)
+{
+	/* data already buffered is skipped, like dfu_multi_image_write does */
+	size_t used = MIN(next_offset - MIN(offset, next_offset), size);
+
+	while (used < size && !chunks[fill_idx].ready) {
+		struct chunk *c = &chunks[fill_idx];
+		size_t n = MIN(size - used, CHUNK_SIZE - c->len);
+
+		if (c->len == 0) {
+			c->offset = next_offset;
+		}
+		memcpy(c->data + c->len, data + used, n);
+		c->len += n;
+		used += n;
+		next_offset += n;
+		if (c->len == CHUNK_SIZE) {
+			chunk_submit();
+		}
+	}
+	return used;
+}
+
+/* Feed the waiting writes, returns the number of callbacks to call */
+static size_t pending_feed(struct done_call *calls)
+{
+	size_t n = 0;
+
+	while (pending_count) {
+		struct pending *p = &pending[pending_head];
+		int err = async_err;
+
+		if (!err && p->offset > next_offset) {
+			err = -ESPIPE;
+		}
+		if (!err) {
+			size_t used = chunk_feed(p->offset, p->data, p->size);
+			p->offset += used;
+			p->data += used;
+			p->size -= used;
+			if (p->size) {
+				break;
+			}
+		}
+		calls[n++] = (struct done_call){ .done = p->done, .ctx = p->ctx, .err = err };
+		if (err && !async_err) {
+			async_err = err;
+		}
+		pending_head = (pending_head + 1) % PENDING_MAX;
+		pending_count--;
+	}
+
+	if (async_final && !pending_count && chunks[fill_idx].len && !chunks[fill_idx].ready) {
+		chunk_submit();
+	}
+	return n;
+}
+
+static void done_calls(const struct done_call *calls, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		if (calls[i].done) {
+			calls[i].done(calls[i].ctx, calls[i].err);
+		}
+	}
+}
+
+static void flush_work_handler(struct k_work *work)
+{
+	struct done_call calls[PENDING_MAX];
+	size_t n;
+
+	k_mutex_lock(&async_lock, K_FOREVER);
+	while (chunks[flush_idx].ready) {
+		struct chunk *c = &chunks[flush_idx];
+		int err = async_err;
+
+		k_mutex_unlock(&async_lock);
+		uint32_t start = k_cycle_get_32();
+		if (!err) {
+			err = dfu_multi_image_write(c->offset, c->data, c->len);
+		}
+		uint32_t time_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+		k_mutex_lock(&async_lock, K_FOREVER);
+
+		if (err) {
+			if (!async_err) {
+				LOG_ERR("image write at %zu fail %d", c->offset, err);
+				async_err = err;
+			}
+		} else {
+			stats.bytes += c->len;
+			stats.flushes++;
+			stats.flash_time_us += time_us;
+			stats.flash_time_max_us = MAX(stats.flash_time_max_us, time_us);
+			stats.elapsed_ms = (uint32_t)(k_uptime_get() - first_write_ms);
+		}
+		c->len = 0;
+		c->ready = false;
+		flush_idx ^= 1;
+		if (chunks[fill_idx].ready) {
+			fill_idx ^= 1;
+		}
+
+		n = pending_feed(calls);
+		k_mutex_unlock(&async_lock);
+		done_calls(calls, n);
+		k_mutex_lock(&async_lock, K_FOREVER);
+	}
+	k_mutex_unlock(&async_lock);
+}
+
+static void async_reset(void)
+{
+	memset(chunks, 0, sizeof(chunks));
+	fill_idx = 0;
+	flush_idx = 0;
+	next_offset = 0;
+	pending_head = 0;
+	pending_count = 0;
+	async_err = 0;
+	async_final = false;
+	first_write_ms = 0;
+	memset(&stats, 0, sizeof(stats));
+}
+
+static int async_drain(void)
+{
+	struct k_work_sync sync;
+	bool busy = true;
+
+	k_mutex_lock(&async_lock, K_FOREVER);
+	async_final = true;
+	if (!pending_count && chunks[fill_idx].len && !chunks[fill_idx].ready) {
+		chunk_submit();
+	}
+	k_mutex_unlock(&async_lock);
+
+	while (busy) {
+		(void)k_work_submit_to_queue(&nordic_dfu_img_workq, &flush_work);
+		(void)k_work_flush(&flush_work, &sync);
+		k_mutex_lock(&async_lock, K_FOREVER);
+		busy = !async_err && (pending_count || chunks[flush_idx].ready);
+		k_mutex_unlock(&async_lock);
+	}
+
+	struct nordic_dfu_img_stats s;
+	nordic_dfu_img_stats_get(&s);
+	LOG_INF("image %u B in %u ms, %u B/s, flash %u B/s, %u writes waited", s.bytes,
+		s.elapsed_ms, s.bytes_per_s, s.flash_bytes_per_s, s.deferred);
+
+	return async_err;
+}
+
+static void async_cancel(void)
+{
+	struct k_work_sync sync;
+	struct done_call calls[PENDING_MAX];
+	size_t n = 0;
+
+	if (!async_initialized) {
+		return;
+	}
+
+	k_mutex_lock(&async_lock, K_FOREVER);
+	async_err = -ECANCELED;
+	n = pending_feed(calls);
+	k_mutex_unlock(&async_lock);
+
+	/* a chunk already in the flash write is completed */
+	(void)k_work_cancel_sync(&flush_work, &sync);
+	done_calls(calls, n);
+
+	k_mutex_lock(&async_lock, K_FOREVER);
+	async_reset();
+	/* writes still on their way are rejected until the next image is initialized */
+	async_err = -ECANCELED;
+	k_mutex_unlock(&async_lock);
+}
+
+static void async_init(void)
+{
+	if (!async_initialized) {
+		async_initialized = true;
+		k_work_init(&flush_work, flush_work_handler);
+		k_work_queue_init(&nordic_dfu_img_workq);
+		k_work_queue_start(&nordic_dfu_img_workq, nordic_dfu_img_workq_stack,
+				   K_THREAD_STACK_SIZEOF(nordic_dfu_img_workq_stack),
+				   CONFIG_SIDEWALK_DFU_IMG_ASYNC_PRIORITY, NULL);
+		k_thread_name_set(&nordic_dfu_img_workq.thread, "dfu_img");
+	}
+
+	/* drop what is left of the previous image */
+	async_cancel();
+
+	k_mutex_lock(&async_lock, K_FOREVER);
+	async_err = 0;
+	k_mutex_unlock(&async_lock);
+}
+
+int nordic_dfu_img_write_async(size_t offset, void *data, size_t data_size,
+			       nordic_dfu_img_done_t done, void *ctx)
+{
+	int err = 0;
+
+	k_mutex_lock(&async_lock, K_FOREVER);
+	if (async_err) {
+		err = async_err;
+		goto out;
+	}
+	if (!first_write_ms) {
+		first_write_ms = k_uptime_get();
+	}
+	if (!pending_count) {
+		if (offset > next_offset) {
+			LOG_ERR("image data at %zu, expected %zu", offset, next_offset);
+			err = -ESPIPE;
+			goto out;
+		}
+		size_t used = chunk_feed(offset, data, data_size);
+		if (used == data_size) {
+			goto out;
+		}
+		offset += used;
+		data = (uint8_t *)data + used;
+		data_size -= used;
+	} else if (pending_count == PENDING_MAX) {
+		err = -ENOBUFS;
+		goto out;
+	}
+
+	pending[(pending_head + pending_count) % PENDING_MAX] = (struct pending){
+		.offset = offset, .data = data, .size = data_size, .done = done, .ctx = ctx
+	};
+	pending_count++;
+	stats.deferred++;
+	err = -EINPROGRESS;
+out:
+	k_mutex_unlock(&async_lock);
+	return err;
+}
+
+void nordic_dfu_img_stats_get(struct nordic_dfu_img_stats *out)
+{
+	k_mutex_lock(&async_lock, K_FOREVER);
+	*out = stats;
+	k_mutex_unlock(&async_lock);
+
+	if (out->elapsed_ms) {
+		out->bytes_per_s =
+			(uint32_t)((uint64_t)out->bytes * MSEC_PER_SEC / out->elapsed_ms);
+	}
+	if (out->flash_time_us) {
+		out->flash_bytes_per_s =
+			(uint32_t)((uint64_t)out->bytes * USEC_PER_SEC / out->flash_time_us);
+	}
+}
+
+void nordic_dfu_img_stats_reset(void)
+{
+	k_mutex_lock(&async_lock, K_FOREVER);
+	memset(&stats, 0, sizeof(stats));
+	first_write_ms = k_uptime_get();
+	k_mutex_unlock(&async_lock);
+}
+#endif /* CONFIG_SIDEWALK_DFU_IMG_ASYNC */
+
 int nordic_dfu_img_init(void)
 {
 	int err = 0;
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+	async_init();
+#endif
 	err = dfu_target_mcuboot_set_buf(image_buf, sizeof(image_buf));
 	if (err) {
 		LOG_ERR("mcuboot set buffor fail %d", err);
@@ -85,12 +415,23 @@ int nordic_dfu_img_write(size_t offset, void *data, size_t data_size)
 
 int nordic_dfu_img_cancel(void)
 {
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+	async_cancel();
+#endif
 	return dfu_multi_image_done(false);
 }
 
 int nordic_dfu_img_finalize(void)
 {
 	int err = 0;
+#ifdef CONFIG_SIDEWALK_DFU_IMG_ASYNC
+	err = async_drain();
+	if (err) {
+		LOG_ERR("image write fail %d", err);
+		(void)dfu_multi_image_done(false);
+		return -ESPIPE;
+	}
+#endif
 	err = dfu_multi_image_done(true);
 	if (err) {
 		LOG_ERR("coplete dfu fail %d", err);
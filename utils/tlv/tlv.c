@@ -26,12 +26,101 @@ static void header_to_bytes(tlv_header header, uint8_t data[4])
 	data[3] = header.payload_size.data_size;
 }
 
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+static const struct tlv_index_entry *index_find(const struct tlv_index *index, tlv_type type)
+{
+	for (uint16_t i = 0; i < index->count; i++) {
+		if (index->entries[i].type == type) {
+			return &index->entries[i];
+		}
+	}
+	return NULL;
+}
+
+static void index_add(struct tlv_index *index, tlv_header header, uint32_t payload_offset)
+{
+	if (index_find(index, header.type)) {
+		/* lookups find the first entry of the type */
+		return;
+	}
+	if (index->count == ARRAY_SIZE(index->entries)) {
+		index->complete = false;
+		return;
+	}
+	index->entries[index->count++] = (struct tlv_index_entry){
+		.type = header.type, .payload_size = header.payload_size, .offset = payload_offset
+	};
+}
+
+/* Returns 0 when found, -ENODATA when the type is not stored, -ENOENT when the index can not tell */
+static int index_lookup(tlv_ctx *ctx, tlv_type type, const struct tlv_index_entry **entry)
+{
+	if (ctx->index == NULL) {
+		return -ENOENT;
+	}
+	*entry = index_find(ctx->index, type);
+	if (*entry) {
+		return 0;
+	}
+	return ctx->index->complete ? -ENODATA : -ENOENT;
+}
+
+int tlv_index_build(tlv_ctx *ctx, struct tlv_index *index)
+{
+	if (ctx == NULL || index == NULL || ctx->storage_impl.read == NULL) {
+		return -EINVAL;
+	}
+
+	ctx->index = NULL;
+	*index = (struct tlv_index){ .complete = true };
+
+	uint32_t offset = ctx->start_offset + ctx->tlv_storage_start_marker_size;
+	while ((offset + sizeof(tlv_header)) <= ctx->end_offset) {
+		uint8_t header_raw[4] = { 0 };
+		int ret = ctx->storage_impl.read(ctx->storage_impl.ctx, offset, header_raw,
+						 sizeof(header_raw));
+		if (ret != 0) {
+			return ret;
+		}
+		tlv_header header = bytes_to_header(header_raw);
+		if (header.type == UINT16_MAX || header.payload_size.data_size == 0) {
+			break;
+		}
+		offset += sizeof(header_raw);
+		index_add(index, header, offset);
+		offset += header.payload_size.data_size + header.payload_size.padding;
+	}
+	index->next_free_offset = MIN(offset, ctx->end_offset);
+	ctx->index = index;
+
+	return 0;
+}
+
+void tlv_index_invalidate(tlv_ctx *ctx)
+{
+	if (ctx) {
+		ctx->index = NULL;
+	}
+}
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+
 int tlv_lookup(tlv_ctx *ctx, tlv_type type, tlv_header *lookup_data)
 {
 	if (ctx == NULL || ctx->storage_impl.read == NULL) {
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	const struct tlv_index_entry *entry;
+	int index_ret = index_lookup(ctx, type, &entry);
+	if (index_ret == 0 && lookup_data) {
+		*lookup_data = (tlv_header){ .type = type, .payload_size = entry->payload_size };
+	}
+	if (index_ret != -ENOENT) {
+		return index_ret;
+	}
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+
 	for (uint32_t offset = ctx->start_offset + ctx->tlv_storage_start_marker_size;
 	     (offset + sizeof(tlv_header)) <= ctx->end_offset;) {
 		uint8_t header_raw[4] = { 0 };
@@ -60,6 +149,23 @@ int tlv_read(tlv_ctx *ctx, tlv_type type, uint8_t *data, uint16_t data_size)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	const struct tlv_index_entry *entry;
+	int index_ret = index_lookup(ctx, type, &entry);
+	if (index_ret == 0) {
+		if (data_size > entry->payload_size.data_size + entry->payload_size.padding) {
+			return -ENOMEM;
+		}
+		if (entry->offset + data_size > ctx->end_offset) {
+			return -ENODATA;
+		}
+		return ctx->storage_impl.read(ctx->storage_impl.ctx, entry->offset, data, data_size);
+	}
+	if (index_ret != -ENOENT) {
+		return index_ret;
+	}
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+
 	for (uint32_t offset = ctx->start_offset + ctx->tlv_storage_start_marker_size;
 	     (offset + sizeof(tlv_header)) <= ctx->end_offset;) {
 		uint8_t header_raw[4] = { 0 };
@@ -93,6 +199,11 @@ static uint32_t get_next_free_offset(tlv_ctx *ctx)
 	if (ctx->storage_impl.read == NULL) {
 		return ctx->end_offset;
 	}
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	if (ctx->index) {
+		return ctx->index->next_free_offset;
+	}
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
 	for (uint32_t offset = ctx->start_offset + ctx->tlv_storage_start_marker_size;
 	     offset <= ctx->end_offset;) {
 		uint8_t header_raw[4] = { 0 };
@@ -111,13 +222,11 @@ static uint32_t get_next_free_offset(tlv_ctx *ctx)
 	return ctx->end_offset;
 }
 
-int tlv_write(tlv_ctx *ctx, tlv_type type, const uint8_t *data, uint16_t data_size)
+/* Write the entry at *offset, and move *offset after it */
+static int write_entry(tlv_ctx *ctx, uint32_t *offset, tlv_type type, const uint8_t *data,
+		       uint16_t data_size)
 {
-	if (ctx == NULL || ctx->storage_impl.read == NULL || ctx->storage_impl.write == NULL) {
-		return -EINVAL;
-	}
-
-	uint32_t next_free_offset = get_next_free_offset(ctx);
+	uint32_t next_free_offset = *offset;
 	if (ctx->end_offset <
 	    (next_free_offset + sizeof(tlv_header) + data_size + CALCULATE_PADDING(data_size))) {
 		return -ENOMEM;
@@ -131,9 +240,15 @@ int tlv_write(tlv_ctx *ctx, tlv_type type, const uint8_t *data, uint16_t data_si
 	int ret = ctx->storage_impl.write(ctx->storage_impl.ctx, next_free_offset, header_raw,
 					  sizeof(header_raw));
 	if (ret != 0) {
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+		tlv_index_invalidate(ctx);
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
 		return ret;
 	}
 	next_free_offset += sizeof(header);
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	const uint32_t payload_offset = next_free_offset;
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
 	uint8_t write_buff[DATA_ALIGN] = { 0x0 };
 	uint16_t data_written = 0;
 	while (data_written < data_size) {
@@ -146,14 +261,59 @@ int tlv_write(tlv_ctx *ctx, tlv_type type, const uint8_t *data, uint16_t data_si
 		ret = ctx->storage_impl.write(ctx->storage_impl.ctx, next_free_offset, write_buff,
 					      DATA_ALIGN);
 		if (ret != 0) {
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+			tlv_index_invalidate(ctx);
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
 			return ret;
 		}
 		next_free_offset += DATA_ALIGN;
 		data_written += DATA_ALIGN;
 	}
+	/* an empty entry is a free slot, the next write goes over it */
+	if (data_size == 0) {
+		return 0;
+	}
+#ifdef CONFIG_SIDEWALK_TLV_INDEX
+	if (ctx->index) {
+		index_add(ctx->index, header, payload_offset);
+		ctx->index->next_free_offset = next_free_offset;
+	}
+#endif /* CONFIG_SIDEWALK_TLV_INDEX */
+	*offset = next_free_offset;
+	return 0;
+}
+
+int tlv_write(tlv_ctx *ctx, tlv_type type, const uint8_t *data, uint16_t data_size)
+{
+	if (ctx == NULL || ctx->storage_impl.read == NULL || ctx->storage_impl.write == NULL) {
+		return -EINVAL;
+	}
+
+	uint32_t next_free_offset = get_next_free_offset(ctx);
+	return write_entry(ctx, &next_free_offset, type, data, data_size);
+}
+
+int tlv_writer_init(struct tlv_writer *writer, tlv_ctx *ctx)
+{
+	if (writer == NULL || ctx == NULL || ctx->storage_impl.read == NULL ||
+	    ctx->storage_impl.write == NULL) {
+		return -EINVAL;
+	}
+
+	*writer = (struct tlv_writer){ .ctx = ctx, .offset = get_next_free_offset(ctx) };
 	return 0;
 }
 
+int tlv_writer_append(struct tlv_writer *writer, tlv_type type, const uint8_t *data,
+		      uint16_t data_size)
+{
+	if (writer == NULL || writer->ctx == NULL || writer->ctx->storage_impl.write == NULL) {
+		return -EINVAL;
+	}
+
+	return write_entry(writer->ctx, &writer->offset, type, data, data_size);
+}
+
 int tlv_read_start_marker(tlv_ctx *ctx, uint8_t *data, uint8_t data_size)
 {
 	if (ctx == NULL || ctx->storage_impl.read == NULL) {
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <errno.h>
+#include <zephyr/sys/util.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <tlv/tlv.h>
+
+static bool window_overlaps(struct tlv_read_ahead *read_ahead, uint32_t offset, uint32_t size)
+{
+	return read_ahead->window_size != 0 && offset < read_ahead->window_offset +
+							       read_ahead->window_size &&
+	       read_ahead->window_offset < offset + size;
+}
+
+static int read_ahead_read(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_size)
+{
+	struct tlv_read_ahead *read_ahead = (struct tlv_read_ahead *)ctx;
+
+	read_ahead->stats.reads++;
+	if (read_ahead->window_size != 0 && offset >= read_ahead->window_offset &&
+	    offset + data_size <= read_ahead->window_offset + read_ahead->window_size) {
+		memcpy(data, read_ahead->window + (offset - read_ahead->window_offset), data_size);
+		read_ahead->stats.hits++;
+		return 0;
+	}
+
+	uint32_t fill_size = 0;
+	if (offset < read_ahead->end_offset) {
+		fill_size = MIN(sizeof(read_ahead->window), read_ahead->end_offset - offset);
+	}
+
+	read_ahead->stats.backend_reads++;
+	if (data_size >= fill_size) {
+		/* nothing to gain, or the window does not fit, read past it */
+		return read_ahead->backend.read(read_ahead->backend.ctx, offset, data, data_size);
+	}
+
+	read_ahead->window_size = 0;
+	int ret = read_ahead->backend.read(read_ahead->backend.ctx, offset, read_ahead->window,
+					   fill_size);
+	if (ret != 0) {
+		return ret;
+	}
+	read_ahead->window_offset = offset;
+	read_ahead->window_size = fill_size;
+	memcpy(data, read_ahead->window, data_size);
+	return 0;
+}
+
+static int read_ahead_write(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_size)
+{
+	struct tlv_read_ahead *read_ahead = (struct tlv_read_ahead *)ctx;
+
+	if (window_overlaps(read_ahead, offset, data_size)) {
+		tlv_read_ahead_invalidate(read_ahead);
+	}
+	return read_ahead->backend.write(read_ahead->backend.ctx, offset, data, data_size);
+}
+
+static int read_ahead_erase(void *ctx, uint32_t offset, uint32_t size)
+{
+	struct tlv_read_ahead *read_ahead = (struct tlv_read_ahead *)ctx;
+
+	if (window_overlaps(read_ahead, offset, size)) {
+		tlv_read_ahead_invalidate(read_ahead);
+	}
+	return read_ahead->backend.erase(read_ahead->backend.ctx, offset, size);
+}
+
+int tlv_read_ahead_attach(tlv_ctx *ctx, struct tlv_read_ahead *read_ahead)
+{
+	if (ctx == NULL || read_ahead == NULL || ctx->storage_impl.read == NULL) {
+		return -EINVAL;
+	}
+
+	*read_ahead = (struct tlv_read_ahead){ .backend = ctx->storage_impl,
+					       .end_offset = ctx->end_offset };
+	ctx->storage_impl = (struct tlv_storage){ .ctx = read_ahead,
+						  .read = read_ahead_read,
+						  .write = read_ahead->backend.write ? read_ahead_write :
+										       NULL,
+						  .erase = read_ahead->backend.erase ? read_ahead_erase :
+										       NULL };
+	return 0;
+}
+
+void tlv_read_ahead_invalidate(struct tlv_read_ahead *read_ahead)
+{
+	if (read_ahead) {
+		/* the window may hold secrets of the storage, do not leave them in RAM */
+		volatile uint8_t *p = read_ahead->window;
+
+		for (size_t i = 0; i < sizeof(read_ahead->window); i++) {
+			p[i] = 0;
+		}
+		read_ahead->window_size = 0;
+	}
+}